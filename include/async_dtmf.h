@@ -2,6 +2,7 @@
 #define __ASYNC_DTMF_H__
 
 #include <Arduino.h>
+#include "fast_random.h"
 
 // AsyncDTMF - DTMF sequence timing manager (similar to AsyncTelco)
 // Handles the timing and state transitions for DTMF digit sequences
@@ -42,6 +43,7 @@ private:
     unsigned long _next_event_time;
     bool _transmitting;
     bool _active;
+    FastRandom *_random;    // owning station's stream
     
     // Human timing calculation helpers
     unsigned long calculateToneDuration();      // Variable tone hold time
@@ -50,6 +52,9 @@ private:
 
 public:
     AsyncDTMF();
+
+    // Random stream for the human timing variation (fast_random until set)
+    void set_random(FastRandom *random) { _random = random; }
     
     // Initialize with digit sequence
     void start_dtmf_transmission(const char* sequence, bool repeating = true);
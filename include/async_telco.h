@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "telco_types.h"
+#include "fast_random.h"
 
 // Ring/Telco timing constants (in milliseconds) - now supports multiple patterns
 // Ringback cadence (North American standard)
@@ -67,6 +68,9 @@ public:
     void start_telco_transmission(bool repeat);
     int step_telco(unsigned long time);
     int get_current_state() { return _current_state; }
+
+    // Random stream for the silence variation (fast_random until set)
+    void set_random(FastRandom *random) { _random = random; }
     
 private:
     void start_next_phase(unsigned long time);
@@ -84,6 +88,8 @@ private:
     unsigned long _tone_b_duration;   // Duration of tone B (ms) - 0 for single tone
     unsigned long _silence_min;       // Minimum silence duration (ms)
     unsigned long _silence_max;       // Maximum silence duration (ms)
+
+    FastRandom *_random;              // Owning station's stream
 };
 
 #endif
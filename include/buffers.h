@@ -6,6 +6,9 @@
 // string buffer used to load string data from program memory (F() strings)
 extern char fstring_buffer[FSTRING_BUFFER];
 
+// string buffer for queued titles, kept for the duration of a non-blocking scroll
+extern char title_text_buffer[FSTRING_BUFFER];
+
 // Global display buffer for VFO and other display updates (max 12 chars + null)
 extern char display_text_buffer[13];
 
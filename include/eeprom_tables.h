@@ -10,6 +10,45 @@
 
 #include <Arduino.h>
 
+// ============================================================================
+// TABLE STORAGE SELECTION
+// ============================================================================
+// TABLE_STORAGE_FLASH          tables read from PROGMEM (fastest, 164 bytes Flash)
+// TABLE_STORAGE_EEPROM         every lookup reads EEPROM (no RAM, no table Flash)
+// TABLE_STORAGE_EEPROM_CACHED  EEPROM behind a small direct-mapped RAM cache
+//                              (2 * TABLE_CACHE_SIZE bytes RAM per table)
+// In both EEPROM modes the tables are CRC-checked once, on first use or at
+// eeprom_tables_init(). See tools/host/table_bench for lookup cost vs RAM:
+// with the direct-mapped cache, 8 entries per table (32 bytes RAM) still
+// misses on 60% of lookups, so USE_EEPROM_TABLES defaults to uncached EEPROM.
+
+#define TABLE_STORAGE_FLASH         0
+#define TABLE_STORAGE_EEPROM        1
+#define TABLE_STORAGE_EEPROM_CACHED 2
+
+#ifndef TABLE_STORAGE
+#ifdef USE_EEPROM_TABLES
+#define TABLE_STORAGE TABLE_STORAGE_EEPROM
+#else
+#define TABLE_STORAGE TABLE_STORAGE_FLASH
+#endif
+#endif
+
+// EEPROM storage and the loader's programming functions need the EEPROM access code
+#if (TABLE_STORAGE != TABLE_STORAGE_FLASH || defined(ENABLE_EEPROM_PROGRAMMING)) && !defined(USE_EEPROM_TABLES)
+#define USE_EEPROM_TABLES
+#endif
+
+// The table layout ends at address 268, past the ATmega4809's 256-byte EEPROM
+#if TABLE_STORAGE != TABLE_STORAGE_FLASH && defined(__AVR_ATmega4809__)
+#error "EEPROM table storage does not fit the ATmega4809 EEPROM, use TABLE_STORAGE_FLASH"
+#endif
+
+// entries per table cache, must be a power of two
+#ifndef TABLE_CACHE_SIZE
+#define TABLE_CACHE_SIZE 8
+#endif
+
 // ============================================================================
 // EEPROM MEMORY MAP
 // ============================================================================
@@ -30,6 +69,54 @@
 #define MORSE_TABLE_MAGIC   0xDA  // "DA" = "DAH" (dash in Morse)
 #define BAUDOT_TABLE_MAGIC  0x5F  // 0x5F = 95 decimal, close to "RTTY" concept
 
+// CRC-8 of each table, written by the loader after the table data
+#define EEPROM_MORSE_TABLE_CRC_ADDR  (EEPROM_MORSE_TABLE_ADDR + MORSE_TABLE_SIZE)    // 136
+#define EEPROM_BAUDOT_TABLE_CRC_ADDR (EEPROM_BAUDOT_TABLE_ADDR + BAUDOT_TABLE_SIZE)  // 268
+
+// CRC-8 (polynomial 0x07) step used to check the tables
+inline byte table_crc8_update(byte crc, byte data) {
+    crc ^= data;
+    for (byte bit = 0; bit < 8; bit++)
+        crc = (crc & 0x80) ? (byte)((crc << 1) ^ 0x07) : (byte)(crc << 1);
+    return crc;
+}
+
+// Direct-mapped cache of table bytes: entry (index % SIZE) holds one index at a time
+template<byte SIZE>
+class TableCache
+{
+public:
+    TableCache() { clear(); }
+
+    void clear() {
+        for (byte i = 0; i < SIZE; i++)
+            _tags[i] = EMPTY;
+    }
+
+    bool get(byte index, byte &value) const {
+        byte slot = index & (SIZE - 1);
+        if (_tags[slot] != index)
+            return false;
+        value = _data[slot];
+        return true;
+    }
+
+    void put(byte index, byte value) {
+        byte slot = index & (SIZE - 1);
+        _tags[slot] = index;
+        _data[slot] = value;
+    }
+
+private:
+    static const byte EMPTY = 0xFF;     // table indexes are below 128
+    byte _tags[SIZE];
+    byte _data[SIZE];
+};
+
+// Table lookups for the configured TABLE_STORAGE
+unsigned char read_morse_table(int index);
+unsigned char read_baudot_table(int index);
+
 // ============================================================================
 // EEPROM TABLE ACCESS FUNCTIONS
 // ============================================================================
@@ -38,7 +125,7 @@
 
 #include <EEPROM.h>
 
-// Check if tables are properly loaded in EEPROM
+// Check if tables are properly loaded in EEPROM (magic numbers and CRC, checked once)
 bool eeprom_tables_valid();
 
 // Load table data from EEPROM (with validation)
@@ -72,6 +159,7 @@ extern const unsigned char morse_table_data[MORSE_TABLE_SIZE];
 extern const unsigned char baudot_table_data[BAUDOT_TABLE_SIZE];
 
 // Functions for programming tables into EEPROM (loader sketch only)
+// Each writes its magic number, data and CRC
 void program_morse_table_to_eeprom();
 void program_baudot_table_to_eeprom();
 void program_all_tables_to_eeprom();
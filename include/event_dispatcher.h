@@ -10,6 +10,9 @@ class SignalMeter;
 #define ID_ENCODER_TUNING 0
 #define ID_ENCODER_MODES 1
 
+// titles (splash, application name) shown before the mode title on the next set_mode()
+#define MAX_QUEUED_TITLES 2
+
 // input: encoder events
 // has: current mode handler
 // output: issues events to the current mode handler
@@ -23,8 +26,10 @@ public:
     void set_mode(HT16K33Disp *display, int nhandler);
     
     // Non-blocking title display management
+    void queue_title(const __FlashStringHelper *title, int show_delay = 0, int scroll_delay = 0);
     bool step_title_display(HT16K33Disp *display);
     bool is_showing_title() const;
+    void clear_titles();        // drops queued titles and stops any title in progress
      
     bool dispatch_event(HT16K33Disp *display, int encoder_id, int event, int event_data);
     bool dispatch_event(HT16K33Disp *display, int encoder_id, bool press, bool long_press);
@@ -41,7 +46,14 @@ private:
     int _nhandlers;
     int _ncurrent_handler;
     
+    void begin_next_title(HT16K33Disp *display);
+
     // Non-blocking title display state
+    const __FlashStringHelper *_queued_titles[MAX_QUEUED_TITLES];
+    int _queued_show_delays[MAX_QUEUED_TITLES];
+    int _queued_scroll_delays[MAX_QUEUED_TITLES];
+    int _nqueued_titles;
+    int _title_stage;           // index of queued title being shown, _nqueued_titles = mode title
     bool _showing_title;
     bool _pending_display_update;
     bool _pending_realization_update;
@@ -0,0 +1,59 @@
+#ifndef __FAST_RANDOM_H__
+#define __FAST_RANDOM_H__
+
+#include <Arduino.h>
+
+// Small deterministic PRNG used in place of Arduino random()
+// Fixed-width types keep host builds bit-identical to the AVR build.
+//
+// random() is a 32-bit LCG followed by a 32-bit modulo, several hundred cycles on AVR.
+// FastRandom is xorshift32 (shifts and XORs only) with range reduction by a 16x16
+// multiply: the high half of value * n is uniform in [0, n) once the rare low-half
+// values that would bias it are rejected (Lemire's method), so there is no divide
+// on the common path.
+//
+// The global fast_random stream serves code that is not tied to a station. Each
+// station owns its own stream, seeded from the base seed and its table index, so a
+// station's behavior does not depend on how often other stations draw numbers.
+
+// Uncomment for the same sequence on every boot (host benchmarks, soak tests)
+// #define FIXED_RANDOM_SEED 0x464C5558UL
+
+class FastRandom
+{
+public:
+    // constexpr so global and station streams are usable during static initialization
+    constexpr FastRandom(uint32_t seed_value = 1) : _state(seed_value ? seed_value : 1) {}
+
+    void seed(uint32_t seed_value) {
+        _state = seed_value ? seed_value : 1;   // xorshift never leaves zero
+    }
+
+    uint32_t next() {
+        uint32_t x = _state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return _state = x;
+    }
+
+    // Unbiased value in [0, n), 0 if n is 0 (as random(0))
+    uint16_t below(uint16_t n);
+
+    // Unbiased value in [0, n) for ranges wider than 16 bits
+    uint32_t below_long(uint32_t n);
+
+private:
+    uint32_t _state;
+};
+
+extern FastRandom fast_random;
+
+// Sets the base seed (FIXED_RANDOM_SEED overrides it) and reseeds fast_random
+void seed_fast_random(uint32_t seed_value);
+
+// Seed for an independent stream, derived from the base seed
+// Stream 0 is fast_random, stations use 1 + their table index
+uint32_t fast_random_stream_seed(byte stream);
+
+#endif
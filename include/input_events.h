@@ -0,0 +1,49 @@
+#ifndef __INPUT_EVENTS_H__
+#define __INPUT_EVENTS_H__
+
+#include <Arduino.h>
+
+// Timestamped encoder and button events captured by EncoderHandler
+//
+// Single producer (encoder/button pin interrupts, or EncoderHandler::step() when polling)
+// and single consumer (the main loop). The producer only writes _head and the consumer
+// only writes _tail, both single bytes, so no interrupt locking is needed. A compiler
+// barrier before each index store keeps the slot copy on the right side of it.
+
+#define INPUT_EVENT_ROTATE 0    // data: +1 CW, -1 CCW, one per detent
+#define INPUT_EVENT_PRESS 1     // debounced button press
+
+// must be a power of two
+#define INPUT_EVENT_RING_SIZE 16
+
+struct InputEvent
+{
+    byte id;                // encoder id (ID_ENCODER_TUNING, ID_ENCODER_MODES)
+    byte type;              // INPUT_EVENT_*
+    int8_t data;
+    unsigned long time;     // millis() at capture
+};
+
+class InputEventRing
+{
+public:
+    InputEventRing();
+
+    // producer side
+    bool push(byte id, byte type, int8_t data, unsigned long time);
+
+    // consumer side
+    bool pop(InputEvent &event);
+    void reset();               // discard all pending events
+    byte dropped() const { return _dropped; }
+
+private:
+    InputEvent _events[INPUT_EVENT_RING_SIZE];
+    volatile byte _head;
+    volatile byte _tail;
+    volatile byte _dropped;     // events lost to a full ring
+};
+
+extern InputEventRing input_events;
+
+#endif // __INPUT_EVENTS_H__
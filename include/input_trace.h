@@ -0,0 +1,69 @@
+#ifndef __INPUT_TRACE_H__
+#define __INPUT_TRACE_H__
+
+#include <Arduino.h>
+
+// Tuning trace capture: timestamped encoder detents, button edges and application
+// switches, streamed over Serial for replay on the host (tools/host/input_replay)
+//
+// Records are delta-encoded into a byte ring by the encoder interrupt handlers and the
+// main loop, and the main loop sends whatever Serial can take without blocking. Serial
+// must carry nothing else while tracing (leave the DEBUG_* output disabled).
+
+// Uncomment to capture and stream input traces (adds INPUT_TRACE_RING_SIZE bytes of RAM)
+// #define ENABLE_INPUT_TRACE
+
+// Stream: "FXT1", the start time (millis(), 4 bytes little-endian), then records.
+// Record byte: kind in the high nibble, milliseconds since the previous record in the
+// low nibble. A nibble of INPUT_TRACE_DELTA_ESCAPE is followed by the full delta as a
+// little-endian base-128 varint. APP and LOST records carry one more value byte.
+#define INPUT_TRACE_MAGIC "FXT1"
+#define INPUT_TRACE_DELTA_ESCAPE 15
+
+// record kinds; the first four are offset by the encoder id (0 = A, 1 = B)
+#define INPUT_TRACE_CW 0        // one detent clockwise
+#define INPUT_TRACE_CCW 2       // one detent counter-clockwise
+#define INPUT_TRACE_DOWN 4      // debounced button press
+#define INPUT_TRACE_UP 6        // debounced button release
+#define INPUT_TRACE_APP 8       // application switch, value: APP_SIMRADIO or APP_SETTINGS
+#define INPUT_TRACE_LOST 9      // value: records dropped before this one (ring full)
+
+// must be a power of two
+#define INPUT_TRACE_RING_SIZE 64
+
+#ifdef ENABLE_INPUT_TRACE
+
+class InputTrace
+{
+public:
+    InputTrace();
+
+    // writes the stream header; call once after Serial.begin()
+    void begin(unsigned long time);
+
+    // producer side: encoder interrupts, or the main loop with interrupts disabled
+    void record(byte kind, unsigned long time, byte value=0);
+
+    // main loop: records an application switch
+    void record_app(byte application, unsigned long time);
+
+    // main loop: sends buffered bytes without blocking
+    void send();
+
+private:
+    bool write_record(byte kind, unsigned long time, byte value);
+    void put(byte b);
+    byte free_space() const;
+
+    byte _ring[INPUT_TRACE_RING_SIZE];
+    volatile byte _head;
+    volatile byte _tail;
+    unsigned long _last_time;   // time of the last record written
+    byte _lost;                 // records dropped since then
+};
+
+extern InputTrace input_trace;
+
+#endif // ENABLE_INPUT_TRACE
+
+#endif // __INPUT_TRACE_H__
@@ -27,7 +27,6 @@ public:
 
     // virtual void step(unsigned long time);
 
-    void show_title(HT16K33Disp *display);
     bool begin_show_title(HT16K33Disp *display);  // Non-blocking version
     bool step_show_title(HT16K33Disp *display);   // Non-blocking step
     virtual void update_display(HT16K33Disp *display);
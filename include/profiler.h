@@ -0,0 +1,96 @@
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <Arduino.h>
+
+// Scoped main loop profiler
+//
+// PROFILE_SCOPE("name") times the rest of the enclosing block and adds it to a static
+// slot for that site: calls, total and longest time. Sending 'p' over Serial prints
+// every slot that has run and starts a new interval. Compiled out unless
+// ENABLE_PROFILER is defined.
+//
+// On the ATmega4809, TCB2 runs free at F_CPU / 2 (0.125 us at 16 MHz). Its 16 bits wrap
+// after 8 ms, so longer scopes fall back to millis(). Other boards use micros().
+// Totals are 32-bit ticks: print at least every 8 minutes.
+
+// Uncomment to build the profiler (uses Serial for commands and output, and TCB2)
+// #define ENABLE_PROFILER
+
+#ifdef ENABLE_PROFILER
+
+#if defined(__AVR_ATmega4809__) && !defined(NATIVE_BUILD)
+#define PROFILE_TIMER TCB2                  // tone() and Servo timers are unused
+#define PROFILE_TICKS_PER_US (F_CPU / 2000000UL)
+#define PROFILE_WRAP_MS 7                   // scopes this long are timed by millis()
+typedef uint16_t profile_ticks_t;
+#define PROFILE_TICKS() (PROFILE_TIMER.CNT)
+#else
+#define PROFILE_TICKS_PER_US 1UL
+typedef unsigned long profile_ticks_t;
+#define PROFILE_TICKS() micros()
+#endif
+
+struct ProfileSlot
+{
+    const char *name;           // PROGMEM
+    ProfileSlot *next;          // printing order, linked on first use
+    bool linked;
+    uint32_t calls;
+    uint32_t total;             // ticks
+    uint32_t longest;           // ticks
+};
+
+void profile_record(ProfileSlot &slot, profile_ticks_t start, unsigned long start_ms);
+
+class ProfileScope
+{
+public:
+    ProfileScope(ProfileSlot &slot) : _slot(slot) {
+#ifdef PROFILE_WRAP_MS
+        _start_ms = millis();
+#endif
+        _start = PROFILE_TICKS();
+    }
+
+    ~ProfileScope() {
+#ifdef PROFILE_WRAP_MS
+        profile_record(_slot, _start, _start_ms);
+#else
+        profile_record(_slot, _start, 0);
+#endif
+    }
+
+private:
+    ProfileSlot &_slot;
+    profile_ticks_t _start;
+#ifdef PROFILE_WRAP_MS
+    unsigned long _start_ms;
+#endif
+};
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+
+// Constant-initialized statics, so a scope costs no guard check
+#define PROFILE_SCOPE(name) \
+    static const char PROFILE_CONCAT(_profile_name_, __LINE__)[] PROGMEM = name; \
+    static ProfileSlot PROFILE_CONCAT(_profile_slot_, __LINE__) = {PROFILE_CONCAT(_profile_name_, __LINE__), nullptr, false, 0, 0, 0}; \
+    ProfileScope PROFILE_CONCAT(_profile_scope_, __LINE__)(PROFILE_CONCAT(_profile_slot_, __LINE__))
+
+// starts the timer and measures the cost of an empty scope; call from setup()
+void profile_begin();
+
+// main loop: handles Serial commands
+void profile_service();
+
+// prints all slots, then clears them for the next interval
+void profile_print();
+
+#else
+
+#define PROFILE_SCOPE(name)
+
+#endif // ENABLE_PROFILER
+
+#endif // __PROFILER_H__
@@ -0,0 +1,40 @@
+#ifndef __RAM_MONITOR_H__
+#define __RAM_MONITOR_H__
+
+#include <Arduino.h>
+
+// Stack high-water mark
+//
+// At reset, before .data and .bss are set up, every byte between the end of .bss and
+// the top of RAM is painted with RAM_CANARY. The stack grows down into that area, so
+// the canary bytes left above .bss are the least free stack there has been since boot.
+// The main loop rescans once per RAM_MONITOR_INTERVAL and reports each new low, as a
+// TELEMETRY_RAM record with ENABLE_TELEMETRY or as a line of text otherwise. The
+// static (.data + .bss) size is reported once at boot.
+//
+// The firmware does not use the heap (tools/check_no_heap.py), so the painted area is
+// all the stack has. A scan reads every untouched byte: about 1 ms for 3 KB at 16 MHz.
+
+// Uncomment to paint RAM at boot and report the stack high-water mark over Serial
+// #define ENABLE_RAM_MONITOR
+
+#define RAM_CANARY 0xC5
+#define RAM_MONITOR_INTERVAL 1000UL     // milliseconds between scans
+
+#ifdef ENABLE_RAM_MONITOR
+
+// call from setup(): reports the static size and the stack used so far
+void ram_monitor_begin();
+
+// main loop: rescans at RAM_MONITOR_INTERVAL and reports a new low
+void ram_monitor_service(unsigned long time);
+
+// .data + .bss in bytes
+unsigned int ram_static_bytes();
+
+// canary bytes still intact above .bss; 0 off the AVR
+unsigned int ram_stack_free_min();
+
+#endif // ENABLE_RAM_MONITOR
+
+#endif // __RAM_MONITOR_H__
@@ -3,6 +3,7 @@
 
 #include "mode.h"
 #include "realization.h"
+#include "station_config.h"
 
 // initialize with an array of realizers
 // tracks whether they are in use
@@ -22,11 +23,21 @@ public:
     void force_sim_transmitter_refresh();  // Force hardware refresh for SimTransmitter objects
     void mark_dirty();  // Mark hardware state as unknown - triggers refresh on next update
 
-private:
+protected:
     Realization **_realizations;
-    bool *_statuses;
     int _nrealizations;
     bool _hardware_dirty;  // True when hardware state is unknown and needs refresh
+
+private:
+    bool *_statuses;
 };
 
+// Pool type for the STATION_TABLE stations, chosen at compile time: RealizationPool,
+// or StationRealizationPool in static_realization_pool.h with ENABLE_STATIC_STATION_DISPATCH
+#ifdef ENABLE_STATIC_STATION_DISPATCH
+class StationRealizationPool;
+#else
+typedef RealizationPool StationRealizationPool;
+#endif
+
 #endif // __REALIZER_POOL_H__
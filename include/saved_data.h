@@ -8,7 +8,7 @@
 // ##DATA Increment the save data version to force upgraded devices to auto-reset after programming
 // Current save data version
 // On start-up if this differs from the EEPROM value, the data is reset to defaults
-#define SAVE_DATA_VERSION 4   // Incremented for setting BFO to 0Hz by default
+#define SAVE_DATA_VERSION 5   // Incremented for wear-leveled save slots
 
 #define DEFAULT_CONTRAST 2
 #define DEFAULT_BFO_OFFSET 0   // 700 Hz default BFO offset for comfortable audio tuning
@@ -32,10 +32,22 @@ struct SavedData{
 	int option_contrast;
 	int option_bfo_offset;
 	int option_flashlight;
+	byte sequence;		// written last; the valid slot with the newest sequence is current
 };
 
+// Wear leveling: the record rotates through every slot that fits in EEPROM 0-99
+// (tables start at EEPROM_TABLES_START_ADDR 100)
+#define SAVE_DATA_AREA_SIZE 100
+#define SAVE_DATA_SLOTS (SAVE_DATA_AREA_SIZE / sizeof(SavedData))
+
+// Settings changes are committed after this long without further changes
+#define SAVE_DATA_IDLE_TIME 3000
+
 extern void load_save_data();
 extern void save_data();
+extern void mark_save_data_dirty();				// settings changed, commit later
+extern void step_save_data(unsigned long time);	// commit once settings are idle
+extern void commit_save_data();					// commit now if anything changed
 extern bool reset_options();
 extern void reset_device();
 
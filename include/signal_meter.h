@@ -1,16 +1,14 @@
 #ifndef __SIGNAL_METER_H__
 #define __SIGNAL_METER_H__
 
-#ifndef NATIVE_BUILD
 #include <Arduino.h>
-#include <Adafruit_NeoPixel.h>
-#endif
 
 // Signal Meter - 7 WS2812 LEDs showing signal strength
 // Uses capacitor-like charging/discharging behavior for realistic analog meter response
 //
 // CAPACITOR BEHAVIOR:
 // - add_charge() sends electrical charge pulses (like current into a capacitor)
+// - Pulses from all stations are collected during a loop pass and applied once by update()
 // - Accumulator builds up charge from multiple pulses
 // - update() applies time-based decay (like capacitor discharge through resistor)
 // - Results in smooth, realistic meter response with persistence and decay
@@ -25,9 +23,17 @@
 // - Decrease DEFAULT_CHARGE for slower buildup (less sensitive)
 // - Decrease DECAY_INTERVAL for smoother decay (more CPU usage)
 //
+// RENDERING:
+// - add_charge(), clear() and the flashlight calls only compose a target pixel buffer
+// - update() pushes it to the strip when it differs from what was last shown,
+//   at most once per SHOW_INTERVAL (show() disables interrupts for ~210us on 7 LEDs)
+// - get_shows_per_second() reports how many show() calls were made in the last second
+//   (define DEBUG_SIGNAL_METER_SHOWS to print it to Serial once per second)
+//
 // S-METER SCALING:
 // Uncomment to enable square root scaling for S-meter-like behavior
 // This compresses strong signals while maintaining sensitivity for weak signals
+// (selects the STRENGTH_TO_LEDS lookup table in signal_meter.cpp)
 #define ENABLE_LOGARITHMIC_S_METER  // TESTING: Enable by default for evaluation
 class SignalMeter
 {
@@ -37,8 +43,8 @@ public:
     SignalMeter();
     
     void init();
-    void add_charge(int charge_amount = DEFAULT_CHARGE);    // Add charge pulse (like electrical charge into capacitor)
-    void update(unsigned long current_time);    // Update with time-based decay
+    void add_charge(int charge_amount = DEFAULT_CHARGE);    // Collect charge pulse (like electrical charge into capacitor)
+    void update(unsigned long current_time);    // Apply collected charge and time-based decay, render once
     void clear();
     
     // Legacy method for backward compatibility (now adds charge instead of setting directly)
@@ -53,8 +59,16 @@ public:
     void set_flashlight_mode(int brightness);  // Set LEDs to white at specified brightness (0-255)
     void clear_flashlight_mode();              // Return to normal signal meter operation
 
+    // Shows colors immediately, bypassing the meter (branding mode)
+    void show_colors(const uint32_t colors[LED_COUNT]);
+
+    // Rendering instrumentation
+    int get_shows_per_second() const { return _shows_per_second; }
+
 private:
-    void write_leds();
+    void write_leds();                          // Compose target buffer, mark dirty on visible change
+    void show_leds(unsigned long current_time); // Push target buffer to the strip (rate limited)
+    void build_palette();                       // Rebuild contrast-scaled colors
     static const int MAX_ACCUMULATOR = 510;     // Maximum accumulator value (2x LED range for resolution)
     // Panel LED lock indicator parameters
     static const int PANEL_LED_MAX_ACCUMULATOR = 255;
@@ -64,9 +78,12 @@ private:
     static const int DECAY_RATE = 16;            // Accumulator decay per update (higher = faster decay)
     static const unsigned long DECAY_INTERVAL = 50;  // Decay update interval in milliseconds
     static const int DEFAULT_CHARGE = 4;        // Default charge amount per pulse (adjusted for square root scaling)
+    static const unsigned long SHOW_INTERVAL = 20;   // Minimum milliseconds between strip updates (50 Hz cap)
     
     int _accumulator;                           // Current charge accumulator (0 to MAX_ACCUMULATOR)
     int _current_strength;                      // Current display strength (0-255)
+    int _pending_charge;                        // Charge collected since last update()
+    int _pending_panel_charge;                  // Lock pulse charge collected since last update()
     unsigned long _last_decay_time;             // Last time decay was applied
     
     int _panel_led_accumulator;                 // Accumulator for panel LED lock indicator (0 to PANEL_LED_MAX_ACCUMULATOR)
@@ -74,10 +91,18 @@ private:
     bool _flashlight_mode;                      // True when in flashlight mode
     int _flashlight_brightness;                 // Brightness level for flashlight mode (0-255)
 
-#ifndef NATIVE_BUILD
-    // Use Adafruit NeoPixel for both platforms
-    static Adafruit_NeoPixel* _led_strip;
-#endif
+    uint32_t _full_colors[LED_COUNT];           // Contrast-scaled color of each fully lit LED
+    uint8_t _partial_levels[16];                // Contrast-scaled channel level for each partial brightness
+    int _palette_contrast;                      // option_contrast the palette was built for
+
+    uint32_t _target_pixels[LED_COUNT];         // Pixel colors wanted on the strip
+    uint32_t _shown_pixels[LED_COUNT];          // Pixel colors last pushed with show()
+    bool _pixels_dirty;                         // Target differs from what is shown
+    unsigned long _last_show_time;              // Time of last show()
+
+    int _show_count;                            // show() calls in the current second
+    int _shows_per_second;                      // show() calls in the last full second
+    unsigned long _show_count_time;             // Start of the current counting second
 };
 
 #endif // __SIGNAL_METER_H__
@@ -19,7 +19,7 @@
 
 // class SignalMeter; // Forward declaration
 
-class SimDTMF : public SimDualTone
+class SimDTMF final : public SimDualTone
 {
 public:
     SimDTMF(WaveGenPool *wave_gen_pool, SignalMeter *signal_meter, float fixed_freq);
@@ -29,6 +29,7 @@ public:
     virtual bool step(unsigned long time) override;
     void realize();
     virtual void randomize() override;  // Re-randomize station properties
+    virtual void seed_random(byte stream) override;
     
 //     // Set station into retry state (used when initialization fails)
 //     void set_retry_state(unsigned long next_try_time);
@@ -41,9 +42,6 @@ public:
 //     AsyncTelco _telco;              // AsyncTelco for ring cadence timing
 //     TelcoType _telco_type;          // Type of telco signal (Ring, Busy, Reorder)
     
-    float _frequency_offset_a;      // Primary frequency offset (Hz)
-    float _frequency_offset_c;      // Secondary frequency offset (Hz)
-    
 //     // Telephony frequency offset constants
 //     static const float RINGBACK_FREQ_A;  // 440 Hz for ringback tone
 //     static const float RINGBACK_FREQ_C;  // 480 Hz for ringback tone  
@@ -94,10 +92,6 @@ public:
     void randomize_station();
 //     void setFrequencyOffsetsForType();  // Set frequency offsets based on telco type
 
-// protected:
-//     // Override frequency offset methods to use stored values instead of macros
-    virtual float getFrequencyOffsetA() const override;
-    virtual float getFrequencyOffsetC() const override;
 };
 
 #endif
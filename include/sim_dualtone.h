@@ -10,6 +10,7 @@
 #include "realization.h"
 #include "station_state.h"
 #include "wave_gen_pool.h"
+#include "fast_random.h"
 
 // // Station states for dynamic station management
 // enum StationState {
@@ -90,17 +91,21 @@ public:
     float get_fixed_frequency() const;  // Get station's target frequency
     void setActive(bool active);
     bool isActive() const;
+    virtual void seed_random(byte stream);  // Reseed this station's stream from the boot seed
+    float get_frequency_a() const { return _frequency; }    // Generator A audio frequency (Hz)
+    float get_frequency_c() const { return _frequency2; }   // Generator C audio frequency (Hz)
 
 protected:    // Common utility methods
     bool check_frequency_bounds();  // Returns true if frequency is in audible range
     bool common_begin(unsigned long time, float fixed_freq);  // Common initialization logic
-    void common_frequency_update(Mode *mode);  // Common frequency calculation (mode must be VFO)
+    void common_frequency_update(Mode *mode);  // Common frequency calculation and bounds check (mode must be VFO)
     void force_frequency_update();  // Immediately update wave generator after _fixed_freq changes
     // void force_frequency_update2();  // Immediately update wave generator after _fixed_freq changes
 
-    // Virtual methods for frequency offsets (allows derived classes to customize)
-    virtual float getFrequencyOffsetA() const;  // Get primary frequency offset (default uses macro)
-    virtual float getFrequencyOffsetC() const;  // Get secondary frequency offset (default uses macro)
+    // Frequency offsets are plain stored values rather than virtual getters, so the
+    // per-update frequency calculation never goes through the vtable
+    float getFrequencyOffsetA() const { return _frequency_offset_a; }  // Get primary frequency offset
+    float getFrequencyOffsetC() const { return _frequency_offset_c; }  // Get secondary frequency offset
 
     // Shared station properties (independent of wave generator)
     float _fixed_freq;  // Target frequency for this station (shared between A and B)
@@ -111,10 +116,16 @@ protected:    // Common utility methods
     float _raw_frequency;   // Current frequency difference from VFO
     float _frequency;   // Current frequency difference from VFO
     float _frequency2;   // Current frequency difference from VFO
+
+    float _frequency_offset_a;  // Primary frequency offset (Hz) - set by derived classes
+    float _frequency_offset_c;  // Secondary frequency offset (Hz) - set by derived classes
     
     // Dynamic station management state
     StationState _station_state;  // Current state in dynamic management system
 
+    // Per-station random stream, so each station's behavior is reproducible on its own
+    FastRandom _random;
+
     // Centralized charge pulse logic for all simulated stations
     virtual void send_carrier_charge_pulse(SignalMeter* signal_meter);
 };
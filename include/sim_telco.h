@@ -7,7 +7,7 @@
 
 class SignalMeter; // Forward declaration
 
-class SimTelco : public SimDualTone
+class SimTelco final : public SimDualTone
 {
 public:
     SimTelco(WaveGenPool *wave_gen_pool, SignalMeter *signal_meter, float fixed_freq, TelcoType type);
@@ -18,18 +18,18 @@ public:
 
     void realize();
     virtual void randomize() override;  // Re-randomize station properties
+    virtual void seed_random(byte stream) override;
     
     // Set station into retry state (used when initialization fails)
     void set_retry_state(unsigned long next_try_time);
 
+    TelcoType get_telco_type() const { return _telco_type; }
+
 private:
     AsyncTelco _telco;              // AsyncTelco for ring cadence timing
     SignalMeter *_signal_meter;
     TelcoType _telco_type;          // Type of telco signal (Ring, Busy, Reorder)
     
-    float _frequency_offset_a;      // Primary frequency offset (Hz)
-    float _frequency_offset_c;      // Secondary frequency offset (Hz)
-    
     // Telephony frequency offset constants
     static const float RINGBACK_FREQ_A;  // 440 Hz for ringback tone
     static const float RINGBACK_FREQ_C;  // 480 Hz for ringback tone  
@@ -53,11 +53,6 @@ private:
 private:
     void randomize_station();
     void setFrequencyOffsetsForType();  // Set frequency offsets based on telco type
-
-protected:
-    // Override frequency offset methods to use stored values instead of macros
-    virtual float getFrequencyOffsetA() const override;
-    virtual float getFrequencyOffsetC() const override;
 };
 
 #endif
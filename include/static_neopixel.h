@@ -0,0 +1,58 @@
+#ifndef __STATIC_NEOPIXEL_H__
+#define __STATIC_NEOPIXEL_H__
+
+#include <Adafruit_NeoPixel.h>
+
+// Adafruit_NeoPixel without the heap
+//
+// The library's (count, pin, type) constructor mallocs the pixel buffer and its
+// destructor frees it. StaticNeoPixel starts from the default constructor, which
+// allocates nothing, and points the library at a buffer sized at compile time.
+// StaticNeoPixelStrip holds one that is never destroyed, so free() is not linked either.
+// Pixel count and type are fixed: updateLength() and updateType() would malloc, so
+// neither is called, not even from the constructor.
+
+template<uint16_t COUNT, neoPixelType TYPE>
+class StaticNeoPixel : public Adafruit_NeoPixel
+{
+public:
+    // matches the library's test for a 3-byte (RGB) type; RGBW needs 4 bytes per pixel
+    static_assert(((TYPE >> 6) & 0b11) == ((TYPE >> 4) & 0b11), "StaticNeoPixel holds RGB pixels only");
+
+    StaticNeoPixel(int16_t pin) {
+        // updateType()'s body, without its reallocating branch: the library function
+        // references updateLength() and so malloc()/free(), even when that branch is dead
+        wOffset = (TYPE >> 6) & 0b11;
+        rOffset = (TYPE >> 4) & 0b11;
+        gOffset = (TYPE >> 2) & 0b11;
+        bOffset = TYPE & 0b11;
+#ifdef NEO_KHZ400
+        is800KHz = (TYPE < 256);    // 400 KHz flag is 1<<8
+#endif
+        memset(_buffer, 0, sizeof(_buffer));
+        pixels = _buffer;
+        numLEDs = COUNT;
+        numBytes = sizeof(_buffer);
+        setPin(pin);
+    }
+
+private:
+    uint8_t _buffer[COUNT * 3];
+};
+
+template<uint16_t COUNT, neoPixelType TYPE>
+class StaticNeoPixelStrip
+{
+public:
+    StaticNeoPixelStrip(int16_t pin) : _strip(pin) {}
+    ~StaticNeoPixelStrip() {}       // the union skips ~Adafruit_NeoPixel and its free()
+
+    Adafruit_NeoPixel *operator->() { return &_strip; }
+
+private:
+    union {
+        StaticNeoPixel<COUNT, TYPE> _strip;
+    };
+};
+
+#endif // __STATIC_NEOPIXEL_H__
@@ -0,0 +1,119 @@
+#ifndef __STATIC_REALIZATION_POOL_H__
+#define __STATIC_REALIZATION_POOL_H__
+
+#include "mode.h"
+#include "realization.h"
+#include "realization_pool.h"
+
+// Compile-time typed alternative to RealizationPool (ENABLE_STATIC_STATION_DISPATCH)
+//
+// RealizationPool walks a Realization* array and makes a virtual call per station for
+// every step(), update() and refresh. StaticRealizationPool keeps the same public API
+// but also knows the concrete type of every entry in the shared realizations[] array,
+// so each pool operation is a chain of direct, qualified calls to the station class
+// (SimTelco::step(), SimDTMF::update(), ...). With LTO those calls can be inlined and
+// the loop is unrolled.
+//
+// RealizationPool has no virtual methods: StaticRealizationPool hides step(), update()
+// and force_sim_transmitter_refresh() instead of overriding them, so callers must hold
+// the concrete type. They use StationRealizationPool (declared in realization_pool.h),
+// which is RealizationPool in the default build and the class at the end of this file
+// with ENABLE_STATIC_STATION_DISPATCH. Its type list is generated from STATION_TABLE
+// in station_config.h, terminated by StationListEnd so the macro expansion can leave
+// a trailing comma.
+
+// Terminator for type lists generated by macro expansion
+struct StationListEnd {};
+
+// Recursive typed station list - Index is the position in the shared realizations[] array
+template<int Index, typename... Stations>
+struct StaticStationList;
+
+template<int Index>
+struct StaticStationList<Index>
+{
+    static const int COUNT = Index;
+
+    static bool step(Realization **, unsigned long) { return true; }
+    static void update(Realization **, Mode *) {}
+    static void refresh(Realization **) {}
+};
+
+template<int Index>
+struct StaticStationList<Index, StationListEnd> : StaticStationList<Index> {};
+
+template<int Index, typename Head, typename... Tail>
+struct StaticStationList<Index, Head, Tail...>
+{
+    typedef StaticStationList<Index + 1, Tail...> Next;
+    static const int COUNT = Next::COUNT;
+
+    static bool step(Realization **realizations, unsigned long time){
+        // Qualified call: no vtable lookup, matches RealizationPool's early-out behavior
+        if(!static_cast<Head*>(realizations[Index])->Head::step(time))
+            return false;
+        return Next::step(realizations, time);
+    }
+
+    static void update(Realization **realizations, Mode *mode){
+        static_cast<Head*>(realizations[Index])->Head::update(mode);
+        Next::update(realizations, mode);
+    }
+
+    static void refresh(Realization **realizations){
+        static_cast<Head*>(realizations[Index])->Head::force_wave_generator_refresh();
+        Next::refresh(realizations);
+    }
+};
+
+template<typename... Stations>
+class StaticRealizationPool : public RealizationPool
+{
+public:
+    typedef StaticStationList<0, Stations...> List;
+    static const int COUNT = List::COUNT;
+
+    StaticRealizationPool(Realization **realizations, bool *statuses)
+        : RealizationPool(realizations, statuses, COUNT) {}
+
+    bool step(unsigned long time){
+        return List::step(_realizations, time);
+    }
+
+    void update(Mode *mode){
+        List::update(_realizations, mode);
+
+        // If hardware state is dirty (unknown), force a refresh
+        if(_hardware_dirty) {
+            force_sim_transmitter_refresh();
+            _hardware_dirty = false;
+        }
+    }
+
+    void force_sim_transmitter_refresh(){
+        List::refresh(_realizations);
+    }
+};
+
+#ifdef ENABLE_STATIC_STATION_DISPATCH
+
+#include "sim_telco.h"
+#include "sim_dtmf.h"
+
+// Typed station list, in table order
+#define STATION_TYPE_TELCO(name, ...) SimTelco,
+#define STATION_TYPE_DTMF(name, ...) SimDTMF,
+
+class StationRealizationPool : public StaticRealizationPool<STATION_TABLE(STATION_TYPE_TELCO, STATION_TYPE_DTMF) StationListEnd>
+{
+public:
+    // Same arguments as RealizationPool; the count comes from the type list
+    StationRealizationPool(Realization **realizations, bool *statuses, int)
+        : StaticRealizationPool(realizations, statuses) {}
+};
+
+static_assert(StationRealizationPool::COUNT == STATION_COUNT, "StaticRealizationPool type list does not match STATION_TABLE");
+
+#endif // ENABLE_STATIC_STATION_DISPATCH
+
+#endif // __STATIC_REALIZATION_POOL_H__
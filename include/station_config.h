@@ -5,4 +5,60 @@
 // #define CONFIG_SIMTELCO    // Single SimTelco station for testing duplicate class functionality
 #define CONFIG_ALLTELCO    // Single SimTelco station for testing duplicate class functionality
 
+// Alternative build mode: drive the configured stations through a compile-time typed
+// StaticRealizationPool (direct calls) instead of virtual calls through Realization*
+// #define ENABLE_STATIC_STATION_DISPATCH
+
+// ============================================================================
+// STATION TABLE - the single source of truth for each configuration
+// ============================================================================
+//
+// Each configuration lists its stations exactly once, in order:
+//   TELCO_STATION(name, frequency, telco type, boot state)
+//   DTMF_STATION(name, frequency, boot state)
+//
+// Boot state AUDIBLE starts the station at boot. DORMANT leaves it idle until the
+// StationManager pipeline moves it near the VFO.
+//
+// main.cpp expands the table into the station objects, realizations[],
+// realization_stats[], the RealizationPool (or StaticRealizationPool type list)
+// and the StationManager count. MAX_STATIONS in station_manager.h is derived
+// from it as well, so adding or removing a line here is all that is needed.
+//
+// ============================================================================
+
+#ifdef CONFIG_SIMDTMF
+#define STATION_TABLE(TELCO_STATION, DTMF_STATION) \
+    DTMF_STATION(cw_station2_test1, 555123400L, AUDIBLE) \
+    DTMF_STATION(cw_station2_test2, 867530900L, AUDIBLE)
+#endif
+
+#ifdef CONFIG_SIMTELCO
+#define STATION_TABLE(TELCO_STATION, DTMF_STATION) \
+    TELCO_STATION(cw_station2_test1, 55500000L, TELCO_DIALTONE, AUDIBLE) \
+    TELCO_STATION(cw_station2_test2, 55501000L, TELCO_DIALTONE, AUDIBLE)
+#endif
+
+#ifdef CONFIG_ALLTELCO
+#define STATION_TABLE(TELCO_STATION, DTMF_STATION) \
+    TELCO_STATION(cw_station2_test1,  555123400L, TELCO_RINGBACK, AUDIBLE) \
+    DTMF_STATION(cw_station2_test2,   555130000L, AUDIBLE) \
+    TELCO_STATION(cw_station2_test3,  555200000L, TELCO_DIALTONE, AUDIBLE) \
+    TELCO_STATION(cw_station2_test4,  555250000L, TELCO_DIALTONE, AUDIBLE) \
+    TELCO_STATION(cw_station2_test5,  555300000L, TELCO_RINGBACK, AUDIBLE) \
+    TELCO_STATION(cw_station2_test6,  555350000L, TELCO_RINGBACK, AUDIBLE) \
+    DTMF_STATION(cw_station2_test7,   555400000L, AUDIBLE) \
+    DTMF_STATION(cw_station2_test8,   555500000L, AUDIBLE) \
+    TELCO_STATION(cw_station2_test9,  555450000L, TELCO_BUSY, DORMANT) \
+    TELCO_STATION(cw_station2_test10, 555550000L, TELCO_BUSY, DORMANT)
+#endif
+
+#ifndef STATION_TABLE
+#error "No station configuration selected in station_config.h"
+#endif
+
+// Number of stations in the selected table (compile-time constant)
+#define STATION_TABLE_COUNT_ONE(...) + 1
+#define STATION_COUNT (0 STATION_TABLE(STATION_TABLE_COUNT_ONE, STATION_TABLE_COUNT_ONE))
+
 #endif // STATION_CONFIG_H
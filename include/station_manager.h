@@ -7,32 +7,11 @@
 #include "realization.h"
 #include <stdint.h>
 
-// Dynamic MAX_STATIONS based on configuration
-#ifdef CONFIG_TEN_CW
-#define MAX_STATIONS 21
-#elif defined(CONFIG_MIXED_STATIONS)
-#define MAX_STATIONS 3  // Updated to match actual station count (CW1 + CW2 + SimPager2)
-#elif defined(CONFIG_FIVE_CW) || defined(CONFIG_FIVE_CW_RESOURCE_TEST)
-#define MAX_STATIONS 5
-#elif defined(CONFIG_FOUR_CW) || defined(CONFIG_FOUR_NUMBERS) || defined(CONFIG_FOUR_PAGER) || defined(CONFIG_FOUR_RTTY) || defined(CONFIG_FOUR_JAMMER) || defined(CONFIG_CW_CLUSTER)
-#define MAX_STATIONS 4
-#elif defined(CONFIG_DEV_LOW_RAM) || defined(CONFIG_FILE_PILE_UP)
-#define MAX_STATIONS 3
-#elif defined(CONFIG_MINIMAL_CW) || defined(CONFIG_TEST_PERFORMANCE) || defined(CONFIG_PAGER2_TEST)
-#define MAX_STATIONS 1
-#elif defined(CONFIG_SIMDTMF)
-#define MAX_STATIONS 2
-#elif defined(CONFIG_ALLTELCO)
-#define MAX_STATIONS 10
-#else
-#define MAX_STATIONS 4  // Default fallback
-#endif
+// MAX_STATIONS is derived from STATION_TABLE in station_config.h
+#define MAX_STATIONS STATION_COUNT
 
 #define MAX_AD9833 4
 
-// Debug control - disabled for production
-// #define DEBUG_PIPELINING  // Enable for troubleshooting pipelining issues
-
 // Dynamic pipelining configuration
 #define PIPELINE_LOOKAHEAD_RANGE 8000    // 8 kHz ahead/behind VFO - accommodate 7.2 kHz station placement
 #define PIPELINE_STATION_SPACING 5000    // Minimum 5 kHz between stations
@@ -40,6 +19,20 @@
 #define PIPELINE_REALLOC_THRESHOLD 6000  // Reallocate when VFO moves 6 kHz (60 steps at 100Hz tuning)
 #define PIPELINE_TUNE_DETECT_THRESHOLD 100  // Minimum Hz change to detect tuning activity
 #define VFO_TUNING_STEP_SIZE 100         // VFO tuning step size in Hz - stations must align to these increments
+#define PIPELINE_REALLOC_INTERVAL 200    // Minimum ms between reallocations (was 500ms)
+#define PIPELINE_SETTLE_TIME 5000        // Pause the pipeline after 5 s without tuning - longer to allow listening
+
+// Counters for tools/host/pipeline_eval (WaveGenPool keeps its own under the same flag)
+// #define ENABLE_PIPELINE_STATS
+
+// Pipelining policy, initialized from the defaults above. The host pipeline evaluator
+// replaces it to compare policies; the firmware never changes it.
+struct PipelineParams {
+    uint16_t lookahead_range;    // PIPELINE_LOOKAHEAD_RANGE
+    uint16_t realloc_threshold;  // PIPELINE_REALLOC_THRESHOLD
+    uint16_t realloc_interval;   // PIPELINE_REALLOC_INTERVAL
+    uint16_t settle_time;        // PIPELINE_SETTLE_TIME
+};
 
 class StationManager {
 public:
@@ -70,6 +63,11 @@ public:
     bool isPipelinePaused() const { return pipeline_enabled && tuning_direction == 0; }
     int getTuningDirection() const { return tuning_direction; }
     uint32_t getPipelineCenterFreq() const { return pipeline_center_freq; }
+    void setPipelineParams(const PipelineParams &params) { pipeline_params = params; }
+    const PipelineParams &getPipelineParams() const { return pipeline_params; }
+#ifdef ENABLE_PIPELINE_STATS
+    unsigned long getStationsMoved() const { return stations_moved_total; }
+#endif
     
 private:
     SimDualTone* stations[MAX_STATIONS];
@@ -82,6 +80,11 @@ private:
     uint32_t pipeline_center_freq;
     int tuning_direction; // -1 = down, 0 = stopped, 1 = up
     unsigned long last_tuning_time; // Last time VFO frequency changed significantly
+    unsigned long last_realloc_time; // Last reallocateStations() call
+    PipelineParams pipeline_params;
+#ifdef ENABLE_PIPELINE_STATS
+    unsigned long stations_moved_total;
+#endif
     
     // Private methods
     void activateStation(int idx, uint32_t freq);
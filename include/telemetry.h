@@ -0,0 +1,77 @@
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include <Arduino.h>
+
+// Binary telemetry: fixed-size event records instead of Serial.print debugging
+//
+// TELEMETRY(id, arg, value) queues one record in a RAM ring; the main loop moves what
+// fits into the core's interrupt-driven Serial TX buffer each pass, so recording never
+// waits on the UART. A full ring drops records and reports how many in the next one.
+// tools/host/telemetry_decode turns a Serial capture into a readable log.
+
+// Uncomment to stream telemetry over Serial (adds TELEMETRY_RING_SIZE bytes of RAM)
+// #define ENABLE_TELEMETRY
+
+// Record: 0x80 | id, then arg (7 bits), time (28 bits, millis()) and value (32 bits)
+// packed 7 bits per byte, least significant first. Only the first byte of a record has
+// bit 7 set, so a decoder can start anywhere and skips any text printed in between.
+#define TELEMETRY_RECORD_SIZE 11
+#define TELEMETRY_VERSION 2
+
+#define TELEMETRY_BOOT 0        // value: TELEMETRY_VERSION
+#define TELEMETRY_POOL 1        // arg: valid stations, value: station table size
+#define TELEMETRY_STATION 2     // arg: station, value: frequency (Hz) at pipeline setup
+#define TELEMETRY_STATE 3       // arg: station, value: new StationState
+#define TELEMETRY_GRANT 4       // arg: station, value: generator
+#define TELEMETRY_DENY 5        // arg: station; every generator is in use
+#define TELEMETRY_FREE 6        // arg: station, value: generator
+#define TELEMETRY_TUNING 7      // arg: TELEMETRY_TUNING_*, value: VFO frequency
+#define TELEMETRY_REALLOC 8     // arg: stations to move, value: VFO frequency
+#define TELEMETRY_MOVE 9        // arg: station, value: new frequency
+#define TELEMETRY_VFO 10        // value: VFO frequency, once per tuning frame
+#define TELEMETRY_LOST 11       // value: records dropped before this one
+#define TELEMETRY_RAM 12        // arg: TELEMETRY_RAM_*, value: bytes (ENABLE_RAM_MONITOR)
+#define TELEMETRY_ID_COUNT 13
+
+#define TELEMETRY_TUNING_PAUSED 0
+#define TELEMETRY_TUNING_UP 1
+#define TELEMETRY_TUNING_DOWN 2
+
+#define TELEMETRY_RAM_STATIC 0  // .data + .bss, once at boot
+#define TELEMETRY_RAM_STACK 1   // least free stack since boot, on each new low
+
+// must be a power of two, at most 256
+#define TELEMETRY_RING_SIZE 128
+
+#ifdef ENABLE_TELEMETRY
+
+// Main loop only. No constructor: stations and generator pools record from their own
+// constructors, and records before begin() are ignored rather than touching an
+// unconstructed object.
+class Telemetry
+{
+public:
+    void begin();
+    void record(byte id, byte arg, unsigned long value);
+    void send();        // moves buffered bytes into the Serial TX buffer without blocking
+
+private:
+    byte _ring[TELEMETRY_RING_SIZE];
+    byte _head;
+    byte _tail;
+    bool _started;
+    unsigned long _lost;
+};
+
+extern Telemetry telemetry;
+
+#define TELEMETRY(id, arg, value) telemetry.record((id), (arg), (value))
+
+#else
+
+#define TELEMETRY(id, arg, value) do {} while (0)
+
+#endif // ENABLE_TELEMETRY
+
+#endif // __TELEMETRY_H__
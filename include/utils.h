@@ -9,4 +9,10 @@
 extern char * load_f_string(const __FlashStringHelper* f_string, char *override_buffer=NULL);
 extern void random_unique(int count, int max_value, int *result);
 
+// sprintf-free number formatting for the display
+// right-aligns value in width characters filled on the left with pad ('0' or ' ')
+// width 0 uses as many characters as needed; returns the end of the written digits (not terminated)
+extern char * format_uint(char *buffer, unsigned int value, byte width = 0, char pad = ' ');
+extern char * format_ulong(char *buffer, unsigned long value, byte width = 0, char pad = ' ');
+
 #endif
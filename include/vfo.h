@@ -13,7 +13,7 @@ class VFO : public Mode
 {
 public:
     // constructor
-    VFO(const char *title, long frequency, unsigned long step, RealizationPool *realization_pool);
+    VFO(const char *title, long frequency, unsigned long step, StationRealizationPool *realization_pool);
     
     virtual void update_display(HT16K33Disp *display);
     virtual void update_signal_meter(SignalMeter *signal_meter);
@@ -24,12 +24,12 @@ public:
     void mark_hardware_dirty();  // Mark hardware as needing refresh
 
     // Static utility for stations to calculate signal strength charge based on VFO proximity
-    static int calculate_signal_charge(float station_freq, float vfo_freq);
+    static int calculate_signal_charge(long station_freq, long vfo_freq);
 
     unsigned long _frequency;
     byte _sub_frequency;
     unsigned long _step;
-    RealizationPool *_realization_pool;
+    StationRealizationPool *_realization_pool;
 
 private:
 };
@@ -5,6 +5,16 @@
 #include "mode.h"
 #include "mode_handler.h"
 
+// Velocity-based tuning acceleration
+// event_data for rotation events is the detent time in milliseconds (low 16 bits).
+// After TUNING_ACCEL_RUN detents in a row closer together than the interval, each
+// detent moves the VFO by the multiplied step: 100 Hz -> 1 kHz -> 10 kHz
+#define TUNING_ACCEL_FAST_INTERVAL 30   // ms between detents for 100x
+#define TUNING_ACCEL_FAST_MULTIPLIER 100
+#define TUNING_ACCEL_MEDIUM_INTERVAL 80 // ms between detents for 10x
+#define TUNING_ACCEL_MEDIUM_MULTIPLIER 10
+#define TUNING_ACCEL_RUN 3              // consecutive quick detents before accelerating
+
 class VFO_Tuner : public ModeHandler
 {
 public:
@@ -30,6 +40,11 @@ public:
     void step_down(unsigned long steps);
 
 private:
+    unsigned long tuning_step(int direction, unsigned int detent_time);
+
+    unsigned int _last_detent_time;
+    int _last_direction;
+    byte _quick_detents;        // consecutive detents inside TUNING_ACCEL_MEDIUM_INTERVAL
 };
 
 #endif // __VFO_TUNER_H__
@@ -25,10 +25,20 @@ public:
     int get_available_count();
     int get_total_count() { return _nrealizers; }
 
+#ifdef ENABLE_PIPELINE_STATS
+    // Acquisition counters for tools/host/pipeline_eval
+    unsigned long get_acquired_count() const { return _acquired; }
+    unsigned long get_failed_count() const { return _failed; }
+#endif
+
 private:
     WaveGen **_realizers;
     bool *_statuses;
     int _nrealizers;
+#ifdef ENABLE_PIPELINE_STATS
+    unsigned long _acquired;
+    unsigned long _failed;
+#endif
 
 };
 
@@ -6,10 +6,16 @@
 HT16K33Disp::HT16K33Disp(byte address, byte num_displays){
 	set_address(address, num_displays);
 	_loop_running = false;
+	for(byte i = 0; i < MAX_NUM_DIGITS; i++)
+		_framebuffer[i] = 0;
+	_dirty_digits = 0;
+	_background_flush = false;
 }
 
 void HT16K33Disp::set_address(byte address, byte num_displays){
 	_address = address;
+	if(num_displays > MAX_NUM_DISPLAYS)
+		num_displays = MAX_NUM_DISPLAYS;
 	_num_displays = num_displays;
 	_num_digits = _num_displays * NUM_DIGITS_PER_DISPLAY;
 }
@@ -26,28 +32,116 @@ void HT16K33Disp::init(const byte *brightLevels){
 		Wire.beginTransmission(_address + i);
 		Wire.write(0x81); //display ON, blinking OFF
 		Wire.endTransmission();
-		clear();
 	}
+	// display RAM content is unknown after power up
+	for(byte i = 0; i < _num_digits; i++)
+		_framebuffer[i] = 0;
+	refresh();
 }
 
 void HT16K33Disp::write(byte digit, unsigned int data){
-	int display = digit / NUM_DIGITS_PER_DISPLAY;
-	digit -= (display * NUM_DIGITS_PER_DISPLAY);
+	if(digit >= _num_digits)
+		return;
+#ifdef HT16K33Disp_UNBUFFERED
+	_framebuffer[digit] = data;
+	send_digits(digit / NUM_DIGITS_PER_DISPLAY, digit % NUM_DIGITS_PER_DISPLAY, digit % NUM_DIGITS_PER_DISPLAY);
+#else
+	if(_framebuffer[digit] != (uint16_t)data){
+		_framebuffer[digit] = data;
+		_dirty_digits |= (1 << digit);
+	}
+#endif
+}
+
+// mark every digit as changed so the next flush() rewrites the displays
+void HT16K33Disp::invalidate(){
+	_dirty_digits = (uint16_t)((1UL << _num_digits) - 1);
+}
+
+// send changed digits, one transaction per display chip covering the changed span
+// (display RAM auto-increments, so unchanged digits inside the span are resent)
+void HT16K33Disp::flush(){
+	if(!_dirty_digits)
+		return;
+
+	for(byte display = 0; display < _num_displays; display++)
+		flush_display(display);
+}
+
+void HT16K33Disp::flush_display(byte display){
+	byte base = display * NUM_DIGITS_PER_DISPLAY;
+	byte dirty = (_dirty_digits >> base) & ((1 << NUM_DIGITS_PER_DISPLAY) - 1);
+	if(!dirty)
+		return;
+
+	byte first = 0;
+	while(!(dirty & (1 << first)))
+		first++;
+	byte last = NUM_DIGITS_PER_DISPLAY - 1;
+	while(!(dirty & (1 << last)))
+		last--;
+
+	send_digits(display, first, last);
+	_dirty_digits &= ~(((1 << NUM_DIGITS_PER_DISPLAY) - 1) << base);
+}
+
+void HT16K33Disp::set_background_flush(bool enable){
+	_background_flush = enable;
+	if(!enable)
+		flush();
+}
+
+// send the first display chip with changed digits
+// returns true if more digits are still waiting
+bool HT16K33Disp::service(){
+	if(!_dirty_digits)
+		return false;
+
+	for(byte display = 0; display < _num_displays; display++){
+		byte base = display * NUM_DIGITS_PER_DISPLAY;
+		if((_dirty_digits >> base) & ((1 << NUM_DIGITS_PER_DISPLAY) - 1)){
+			flush_display(display);
+			break;
+		}
+	}
+	return _dirty_digits != 0;
+}
+
+// string and clear functions end here
+void HT16K33Disp::commit(){
+	if(!_background_flush)
+		flush();
+}
+
+// rewrite every digit, one burst from RAM address 0 per display chip
+void HT16K33Disp::refresh(){
+	for(byte display = 0; display < _num_displays; display++)
+		send_digits(display, 0, NUM_DIGITS_PER_DISPLAY - 1);
+	_dirty_digits = 0;
+}
+
+void HT16K33Disp::send_digits(byte display, byte first, byte last){
+	byte base = display * NUM_DIGITS_PER_DISPLAY;
 	Wire.beginTransmission(_address + display);
-	Wire.write(digit*2);
-	Wire.write(data);
-	Wire.write(data >> 8);
+	Wire.write(first*2);
+	for(byte digit = first; digit <= last; digit++){
+		uint16_t data = _framebuffer[base + digit];
+		Wire.write(data);
+		Wire.write(data >> 8);
+	}
 	Wire.endTransmission();
 }
 
 void HT16K33Disp::segments_test(){
 	for(byte i = 0; i < _num_digits; i++)
 		write(i, (uint16_t) -1);
+	commit();
 }
 
 void HT16K33Disp::clear(){
 	for(byte i = 0; i < _num_digits; i++)
 		write(i, 0);
+	commit();
 }
 
 // determine the displayable length of the string
@@ -107,6 +201,7 @@ void HT16K33Disp::show_string(const char * string, bool pad_blanks){
 		    string++;
 		}
 	}
+	commit();
 }
 
 void HT16K33Disp::simple_show_string(const char * string){
@@ -123,6 +218,7 @@ void HT16K33Disp::simple_show_string(const char * string){
 		    write(i, char_to_segments(*string));
 		string++;
 	}
+	commit();
 }
 
 // save and restore string in case this is used along with a non-blocking scroll
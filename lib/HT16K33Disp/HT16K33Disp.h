@@ -12,6 +12,16 @@
 
 #define NUM_DIGITS_PER_DISPLAY 4
 
+// framebuffer size - digits are tracked in a 16-bit dirty mask
+#ifndef MAX_NUM_DISPLAYS
+#define MAX_NUM_DISPLAYS 4
+#endif
+#define MAX_NUM_DIGITS (MAX_NUM_DISPLAYS * NUM_DIGITS_PER_DISPLAY)
+
+// define to send every write() immediately as its own I2C transaction
+// (original behavior, kept for before/after measurement with tools/host/i2c_bench)
+// #define HT16K33Disp_UNBUFFERED
+
 #define DEFAULT_SHOW_DELAY 750  // Restored to original value
 #define DEFAULT_SCROLL_DELAY 200
 #define SEGMENT_TEST_DELAY 10
@@ -145,13 +155,25 @@ public:
 	explicit HT16K33Disp(byte address = 0, byte num_displays = 1);
 	void set_address(byte address, byte num_displays);
 
+	// write() only updates the framebuffer; flush() sends changed digits to the displays
 	void write(byte digit, unsigned int data);
+	void flush();
+	void invalidate();
+	void refresh();
+
+	// background flush: string and clear functions leave changed digits queued in the
+	// framebuffer, and service() (called every main loop pass) sends one display chip
+	// per call so no single pass waits on the whole display
+	void set_background_flush(bool enable);
+	bool service();
+	bool pending() const { return _dirty_digits != 0; }
 	void segments_test();
 	void clear();
 	int string_length(const char * string);
 	void show_string(const char * string, bool pad_blanks = true);
 	void simple_show_string(const char * string);
 
+	// blocks until the scroll completes - prefer begin_scroll_string()/step_scroll_string()
 	void scroll_string(const char * string, int show_delay = 0, int scroll_delay = 0);
 	int begin_scroll_string(const char * string, int show_delay = 0, int scroll_delay = 0);
 	bool step_scroll_string(unsigned long time);
@@ -180,6 +202,14 @@ private:
 	bool _loop_running;
 	int _loop_times;
 
+	void send_digits(byte display, byte first, byte last);
+	void flush_display(byte display);
+	void commit();
+
+	uint16_t _framebuffer[MAX_NUM_DIGITS];	// segments last written per digit
+	uint16_t _dirty_digits;					// bit per digit not yet sent to the display
+	bool _background_flush;
+
 };
 
 #endif
\ No newline at end of file
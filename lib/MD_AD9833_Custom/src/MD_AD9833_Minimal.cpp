@@ -31,8 +31,9 @@ void MD_AD9833::begin(void)
   pinMode(_fsyncPin, OUTPUT);
   
   // Set initial states
+  // SCLK idles high: the AD9833 samples SDATA on falling SCLK edges
   digitalWrite(_fsyncPin, HIGH);
-  digitalWrite(_clkPin, LOW);
+  digitalWrite(_clkPin, HIGH);
   digitalWrite(_dataPin, LOW);
   
   // Reset AD9833 and configure for sine wave output
@@ -93,10 +94,11 @@ uint32_t MD_AD9833::calcFreq(float f)
 
 void MD_AD9833::spiSend(uint16_t data)
 {
-  // Software SPI implementation
+  // Software SPI implementation (SPI mode 2): data is set up while SCLK is
+  // high and the AD9833 latches it on the falling edge
   for (int i = 15; i >= 0; i--) {
-    digitalWrite(_clkPin, LOW);
     digitalWrite(_dataPin, (data >> i) & 1);
+    digitalWrite(_clkPin, LOW);
     digitalWrite(_clkPin, HIGH);
   }
 }
@@ -8,16 +8,17 @@ template<byte pin>
 class RandomSeed
 {
 	public:
-	void randomize(void);
+	int randomize(void);	// seeds random() and returns the seed
 };
 
 template<byte pin>
-void RandomSeed<pin>::randomize(void){
+int RandomSeed<pin>::randomize(void){
   int seed = 0;
   while(seed == 0)
 	for(byte i = 0; i < RANDOM_SEED_SAMPLES; i++)
 		seed = (seed << 1) ^ analogRead(pin);
   randomSeed(seed);
+  return seed;
 }
 
 #endif
@@ -10,6 +10,7 @@ AsyncDTMF::AsyncDTMF() {
     _next_event_time = 0;
     _transmitting = false;
     _active = false;
+    _random = &fast_random;
 }
 
 void AsyncDTMF::start_dtmf_transmission(const char* sequence, bool repeating) {
@@ -103,12 +104,12 @@ void AsyncDTMF::reset_sequence() {
 // Human timing calculation helpers for realistic touch-tone dialing behavior
 unsigned long AsyncDTMF::calculateToneDuration() {
     // Humans hold buttons for variable amounts of time (200-400ms)
-    return DTMF_TONE_MIN_DURATION + random(DTMF_TONE_MAX_DURATION - DTMF_TONE_MIN_DURATION);
+    return DTMF_TONE_MIN_DURATION + _random->below(DTMF_TONE_MAX_DURATION - DTMF_TONE_MIN_DURATION);
 }
 
 unsigned long AsyncDTMF::calculateSilenceDuration() {
     // Variable silence between digit tones (100-200ms)
-    return DTMF_SILENCE_MIN_DURATION + random(DTMF_SILENCE_MAX_DURATION - DTMF_SILENCE_MIN_DURATION);
+    return DTMF_SILENCE_MIN_DURATION + _random->below(DTMF_SILENCE_MAX_DURATION - DTMF_SILENCE_MIN_DURATION);
 }
 
 unsigned long AsyncDTMF::calculateDigitGap(int current_position) {
@@ -119,16 +120,16 @@ unsigned long AsyncDTMF::calculateDigitGap(int current_position) {
     if (current_position > 0 && _digit_sequence && 
         current_position < _sequence_length && previous_position >= 0 &&
         _digit_sequence[current_position] == _digit_sequence[previous_position]) {
-        return DTMF_DIGIT_GAP_MIN + random(100);  // 200-300ms for repeated digits
+        return DTMF_DIGIT_GAP_MIN + _random->below(100);  // 200-300ms for repeated digits
     }
     
     // Longer thinking pauses at natural break points based on position just completed
     if (previous_position == 0 ||          // After country code digit (position 0: "1")
         previous_position == 3 ||          // After area code (position 3: last digit of "555")  
         previous_position == 6) {          // After exchange prefix (position 6: last digit of "123")
-        return (DTMF_DIGIT_GAP_MIN + DTMF_DIGIT_GAP_MAX) / 2 + random(200);  // 500-700ms thinking pause
+        return (DTMF_DIGIT_GAP_MIN + DTMF_DIGIT_GAP_MAX) / 2 + _random->below(200);  // 500-700ms thinking pause
     }
     
     // Default inter-digit gap with natural variation
-    return DTMF_DIGIT_GAP_MIN + random(DTMF_DIGIT_GAP_MAX - DTMF_DIGIT_GAP_MIN);  // 200-800ms
+    return DTMF_DIGIT_GAP_MIN + _random->below(DTMF_DIGIT_GAP_MAX - DTMF_DIGIT_GAP_MIN);  // 200-800ms
 }
@@ -10,6 +10,7 @@ AsyncTelco::AsyncTelco()
     _current_state = TELCO_STATE_SILENCE;
     _next_event_time = 0;
     _initialized = false;
+    _random = &fast_random;
     
     // Default to ring timing for backward compatibility
     _tone_a_duration = RING_TONE_A_DURATION;
@@ -144,5 +145,5 @@ void AsyncTelco::start_next_phase(unsigned long time)
 unsigned long AsyncTelco::get_random_silence_duration()
 {
     // Generate random silence duration between min and max (using configurable timing)
-    return _silence_min + random(_silence_max - _silence_min);
+    return _silence_min + _random->below_long(_silence_max - _silence_min);
 }
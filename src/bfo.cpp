@@ -2,8 +2,7 @@
 #include "bfo.h"
 #include "utils.h"
 #include "buffers.h"
-#include <stdlib.h>  // For itoa()
-#include <string.h>  // For strcpy(), strcat()
+#include <string.h>  // For strcpy_P()
 
 BFO::BFO(const char *title) : Option(title)
 {
@@ -24,9 +23,7 @@ void BFO::prev_option(){
 void BFO::update_display(HT16K33Disp *display){
     // No hardware adjustment needed for BFO (unlike contrast which affects display hardware)
     // Manual string building instead of sprintf to save Flash
-    char freq_str[6];
-    itoa(option_bfo_offset, freq_str, 10);
-    strcpy(display_text_buffer, freq_str);
-    strcat(display_text_buffer, " Hz");
-    display->scroll_string(display_text_buffer, 1, 1);
+    char *p = format_uint(display_text_buffer, option_bfo_offset);
+    strcpy_P(p, PSTR(" Hz"));
+    display->show_string(display_text_buffer);
 }
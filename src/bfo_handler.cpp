@@ -17,7 +17,8 @@ bool BFOHandler::event_sink(int event, int event_data){
         bfo->prev_option();
     }
 
-    save_data();
+    // Committed to EEPROM once the setting stops changing
+    mark_save_data_dirty();
 
     return true;
 }
@@ -1,4 +1,5 @@
 #include "../include/buffers.h"
 
 char fstring_buffer[FSTRING_BUFFER];
+char title_text_buffer[FSTRING_BUFFER];
 char display_text_buffer[13];
@@ -24,6 +24,7 @@ void Contrast::prev_option(){
 void Contrast::update_display(HT16K33Disp *display){
 	const byte display_brightnesses[] = {(unsigned char)option_contrast, (unsigned char)option_contrast};
 	display->init(display_brightnesses);
-    sprintf(display_text_buffer, "Level %d", option_contrast);
-    display->scroll_string(display_text_buffer, 1, 1);
+    strcpy_P(display_text_buffer, PSTR("Level "));
+    *format_uint(display_text_buffer + 6, option_contrast) = 0;
+    display->show_string(display_text_buffer);
 }
@@ -20,7 +20,8 @@ bool ContrastHandler::event_sink(int event, int event_data){
         contrast->prev_option();
     }
 
-    save_data();
+    // Committed to EEPROM once the setting stops changing
+    mark_save_data_dirty();
 
     return true;
 }
@@ -81,12 +81,32 @@ const unsigned char baudot_table_data[BAUDOT_TABLE_SIZE] PROGMEM = {
 // EEPROM ACCESS FUNCTIONS
 // ============================================================================
 
+#define TABLES_UNCHECKED 0
+#define TABLES_VALID 1
+#define TABLES_INVALID 2
+
+static byte tables_state = TABLES_UNCHECKED;
+
+static bool eeprom_table_valid(int magic_addr, int table_addr, int size, byte magic, int crc_addr) {
+    if (EEPROM.read(magic_addr) != magic)
+        return false;
+
+    byte crc = 0;
+    for (int i = 0; i < size; i++)
+        crc = table_crc8_update(crc, EEPROM.read(table_addr + i));
+    return crc == EEPROM.read(crc_addr);
+}
+
 bool eeprom_tables_valid() {
-    // Check magic numbers to see if tables are properly loaded
-    byte morse_magic = EEPROM.read(EEPROM_MORSE_TABLE_ADDR - 1);
-    byte baudot_magic = EEPROM.read(EEPROM_BAUDOT_TABLE_ADDR - 1);
-    
-    return (morse_magic == MORSE_TABLE_MAGIC && baudot_magic == BAUDOT_TABLE_MAGIC);
+    // Check magic numbers and CRCs once, the tables do not change while running
+    if (tables_state == TABLES_UNCHECKED) {
+        bool valid = eeprom_table_valid(EEPROM_MORSE_TABLE_ADDR - 1, EEPROM_MORSE_TABLE_ADDR, MORSE_TABLE_SIZE,
+                                        MORSE_TABLE_MAGIC, EEPROM_MORSE_TABLE_CRC_ADDR) &&
+                     eeprom_table_valid(EEPROM_BAUDOT_TABLE_ADDR - 1, EEPROM_BAUDOT_TABLE_ADDR, BAUDOT_TABLE_SIZE,
+                                        BAUDOT_TABLE_MAGIC, EEPROM_BAUDOT_TABLE_CRC_ADDR);
+        tables_state = valid ? TABLES_VALID : TABLES_INVALID;
+    }
+    return tables_state == TABLES_VALID;
 }
 
 unsigned char eeprom_read_morse_data(int index) {
@@ -116,6 +136,63 @@ bool eeprom_tables_init() {
 
 #endif // USE_EEPROM_TABLES
 
+// ============================================================================
+// TABLE LOOKUPS FOR THE CONFIGURED STORAGE
+// ============================================================================
+
+#if TABLE_STORAGE == TABLE_STORAGE_FLASH
+
+unsigned char read_morse_table(int index) {
+    if (index < 0 || index >= MORSE_TABLE_SIZE)
+        return 0;
+    return pgm_read_byte(morse_table_data + index);
+}
+
+unsigned char read_baudot_table(int index) {
+    if (index < 0 || index >= BAUDOT_TABLE_SIZE)
+        return 0xFF;
+    return pgm_read_byte(baudot_table_data + index);
+}
+
+#elif TABLE_STORAGE == TABLE_STORAGE_EEPROM
+
+unsigned char read_morse_table(int index) {
+    return eeprom_tables_valid() ? eeprom_read_morse_data(index) : 0;
+}
+
+unsigned char read_baudot_table(int index) {
+    return eeprom_tables_valid() ? eeprom_read_baudot_data(index) : 0xFF;
+}
+
+#else // TABLE_STORAGE_EEPROM_CACHED
+
+static TableCache<TABLE_CACHE_SIZE> morse_cache;
+static TableCache<TABLE_CACHE_SIZE> baudot_cache;
+
+unsigned char read_morse_table(int index) {
+    if (index < 0 || index >= MORSE_TABLE_SIZE || !eeprom_tables_valid())
+        return 0;
+    byte value;
+    if (!morse_cache.get(index, value)) {
+        value = eeprom_read_morse_data(index);
+        morse_cache.put(index, value);
+    }
+    return value;
+}
+
+unsigned char read_baudot_table(int index) {
+    if (index < 0 || index >= BAUDOT_TABLE_SIZE || !eeprom_tables_valid())
+        return 0xFF;
+    byte value;
+    if (!baudot_cache.get(index, value)) {
+        value = eeprom_read_baudot_data(index);
+        baudot_cache.put(index, value);
+    }
+    return value;
+}
+
+#endif // TABLE_STORAGE
+
 // ============================================================================
 // TABLE PROGRAMMING FUNCTIONS (for loader sketch)
 // ============================================================================
@@ -127,10 +204,17 @@ void program_morse_table_to_eeprom() {
     EEPROM.write(EEPROM_MORSE_TABLE_ADDR - 1, MORSE_TABLE_MAGIC);
     
     // Write morse table data
+    byte crc = 0;
     for (int i = 0; i < MORSE_TABLE_SIZE; i++) {
         byte data = pgm_read_byte(morse_table_data + i);
         EEPROM.write(EEPROM_MORSE_TABLE_ADDR + i, data);
+        crc = table_crc8_update(crc, data);
     }
+    EEPROM.write(EEPROM_MORSE_TABLE_CRC_ADDR, crc);
+
+#ifdef USE_EEPROM_TABLES
+    tables_state = TABLES_UNCHECKED;    // check the new contents on next use
+#endif
 }
 
 void program_baudot_table_to_eeprom() {
@@ -138,18 +222,25 @@ void program_baudot_table_to_eeprom() {
     EEPROM.write(EEPROM_BAUDOT_TABLE_ADDR - 1, BAUDOT_TABLE_MAGIC);
     
     // Write baudot table data
+    byte crc = 0;
     for (int i = 0; i < BAUDOT_TABLE_SIZE; i++) {
         byte data = pgm_read_byte(baudot_table_data + i);
         EEPROM.write(EEPROM_BAUDOT_TABLE_ADDR + i, data);
+        crc = table_crc8_update(crc, data);
     }
+    EEPROM.write(EEPROM_BAUDOT_TABLE_CRC_ADDR, crc);
+
+#ifdef USE_EEPROM_TABLES
+    tables_state = TABLES_UNCHECKED;    // check the new contents on next use
+#endif
 }
 
 void program_all_tables_to_eeprom() {
     program_morse_table_to_eeprom();
     program_baudot_table_to_eeprom();
-    
-    // Optional: Write a global magic number to indicate all tables are loaded
-    EEPROM.write(EEPROM_TABLES_START_ADDR - 1, 0xEE);  // "EEPROM Tables Present"
+
+    // The morse table magic number already sits at EEPROM_TABLES_START_ADDR - 1,
+    // so there is no separate "all tables present" marker
 }
 
 #endif // ENABLE_EEPROM_PROGRAMMING
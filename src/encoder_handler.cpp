@@ -0,0 +1,182 @@
+#include "encoder_handler.h"
+#include "input_trace.h"
+
+EncoderHandler *EncoderHandler::_instances[MAX_ENCODERS];
+
+// quadrature transition table indexed by (previous AB << 2) | current AB
+// +1 / -1 for a valid step, 0 for no change or an invalid (bounced) transition
+static const int8_t QUADRATURE_STEPS[16] = {
+   0, -1,  1,  0,
+   1,  0,  0, -1,
+  -1,  0,  0,  1,
+   0,  1, -1,  0
+};
+
+EncoderHandler::EncoderHandler(byte id, int clock_pin, int data_pin, int button_pin, byte pulses_per_detent){
+  _id = id;
+  _clock_pin = clock_pin;
+  _data_pin = data_pin;
+  _button_pin = button_pin;
+  _pulses_per_detent = pulses_per_detent ? pulses_per_detent : 1;
+
+  _quadrature_state = 0;
+  _pulse_count = 0;
+  _button_level = false;
+  _last_button_edge = 0;
+
+  _held = false;
+  _repeat_time = 0;
+  _long_pressed = false;
+}
+
+#if !defined(ENCODER_POLLING) && defined(__AVR_ATmega328P__)
+// one vector per port (PCINT0..2); set the pin's bit in its port's mask
+static void enable_pin_change(byte pin){
+  *digitalPinToPCMSK(pin) |= bit(digitalPinToPCMSKbit(pin));
+  PCIFR = bit(digitalPinToPCICRbit(pin));   // drop an edge flagged while configuring
+  PCICR |= bit(digitalPinToPCICRbit(pin));
+}
+#endif
+
+void EncoderHandler::begin(){
+  pinMode(_button_pin, INPUT_PULLUP);
+  _button_level = digitalRead(_button_pin) == LOW;
+
+  if(_clock_pin != 0 && _data_pin != 0){
+    pinMode(_clock_pin, INPUT_PULLUP);
+    pinMode(_data_pin, INPUT_PULLUP);
+    _quadrature_state = (digitalRead(_clock_pin) << 1) | digitalRead(_data_pin);
+  }
+
+  // registered only once the pins are set up: on the ATmega328P an edge on the other
+  // encoder's pins runs this handler's decoder too
+  if(_id < MAX_ENCODERS)
+    _instances[_id] = this;
+
+#if defined(ENCODER_POLLING)
+  // step() samples the pins
+#elif defined(__AVR_ATmega328P__)
+  if(_clock_pin != 0 && _data_pin != 0){
+    enable_pin_change(_clock_pin);
+    enable_pin_change(_data_pin);
+  }
+  enable_pin_change(_button_pin);
+#else
+  void (*rotation)() = _id == 0 ? rotation_isr<0> : rotation_isr<1>;
+  void (*button)() = _id == 0 ? button_isr<0> : button_isr<1>;
+  if(_clock_pin != 0 && _data_pin != 0){
+    attachInterrupt(digitalPinToInterrupt(_clock_pin), rotation, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(_data_pin), rotation, CHANGE);
+  }
+  attachInterrupt(digitalPinToInterrupt(_button_pin), button, CHANGE);
+#endif
+}
+
+template<byte ID> void EncoderHandler::rotation_isr(){
+  _instances[ID]->capture_rotation(millis());
+}
+
+template<byte ID> void EncoderHandler::button_isr(){
+  _instances[ID]->capture_button(millis());
+}
+
+// A pin change vector only says that some pin on the port changed. Each decoder
+// compares against its last sampled state, so the ones whose pins did not change
+// return without queuing anything.
+void EncoderHandler::pin_change_isr(){
+  unsigned long time = millis();
+  for(byte i = 0; i < MAX_ENCODERS; i++){
+    EncoderHandler *handler = _instances[i];
+    if(handler == nullptr)
+      continue;
+    if(handler->_clock_pin != 0 && handler->_data_pin != 0)
+      handler->capture_rotation(time);
+    handler->capture_button(time);
+  }
+}
+
+#if !defined(ENCODER_POLLING) && defined(__AVR_ATmega328P__)
+ISR(PCINT0_vect){
+  EncoderHandler::pin_change_isr();
+}
+ISR(PCINT1_vect, ISR_ALIASOF(PCINT0_vect));
+ISR(PCINT2_vect, ISR_ALIASOF(PCINT0_vect));
+#endif
+
+// decode one quadrature transition, queue a rotate event per full detent
+void EncoderHandler::capture_rotation(unsigned long time){
+  byte state = (digitalRead(_clock_pin) << 1) | digitalRead(_data_pin);
+  int8_t step = QUADRATURE_STEPS[(_quadrature_state << 2) | state];
+  _quadrature_state = state;
+  if(step == 0)
+    return;
+
+  int8_t count = _pulse_count + step;
+  if(count >= _pulses_per_detent){
+    count -= _pulses_per_detent;
+    input_events.push(_id, INPUT_EVENT_ROTATE, 1, time);
+#ifdef ENABLE_INPUT_TRACE
+    input_trace.record(INPUT_TRACE_CW + _id, time);
+#endif
+  } else if(count <= -_pulses_per_detent){
+    count += _pulses_per_detent;
+    input_events.push(_id, INPUT_EVENT_ROTATE, -1, time);
+#ifdef ENABLE_INPUT_TRACE
+    input_trace.record(INPUT_TRACE_CCW + _id, time);
+#endif
+  }
+  _pulse_count = count;
+}
+
+// a press is a falling edge after DEBOUNCE_TIME without edges; anything closer is contact bounce
+void EncoderHandler::capture_button(unsigned long time){
+  bool down = digitalRead(_button_pin) == LOW;
+  if(down == _button_level)
+    return;
+  _button_level = down;
+
+  bool settled = time - _last_button_edge >= (unsigned long)DEBOUNCE_TIME;
+  _last_button_edge = time;
+  if(down && settled)
+    input_events.push(_id, INPUT_EVENT_PRESS, 0, time);
+
+#ifdef ENABLE_INPUT_TRACE
+  // releases drive long press repeats, so the trace keeps both edges
+  if(settled)
+    input_trace.record((down ? INPUT_TRACE_DOWN : INPUT_TRACE_UP) + _id, time);
+#endif
+}
+
+void EncoderHandler::step(unsigned long time){
+#ifdef ENCODER_POLLING
+  if(_clock_pin != 0 && _data_pin != 0)
+    capture_rotation(time);
+  capture_button(time);
+#endif
+
+  // repeat while the button stays held
+  if(_held){
+    if(digitalRead(_button_pin) == HIGH){
+      _held = false;
+    } else if((long)(time - _repeat_time) >= 0){
+      _long_pressed = true;
+      _repeat_time = time + REPEAT_TIME;
+    }
+  }
+}
+
+void EncoderHandler::button_pressed(unsigned long time){
+  _held = true;
+  _repeat_time = time + REPEAT_TIME;
+}
+
+bool EncoderHandler::long_pressed(){
+  bool ret = _long_pressed;
+  _long_pressed = false;
+  return ret;
+}
+
+void EncoderHandler::reset(){
+  _held = false;
+  _long_pressed = false;
+}
@@ -1,6 +1,8 @@
 #include "mode_handler.h"
 #include "event_dispatcher.h"
 #include "signal_meter.h"
+#include "buffers.h"
+#include "utils.h"
 
 // change to accept an array of mode handlers
 EventDispatcher::EventDispatcher(ModeHandler **mode_handlers, int nhandlers){
@@ -8,6 +10,8 @@ EventDispatcher::EventDispatcher(ModeHandler **mode_handlers, int nhandlers){
     _nhandlers = nhandlers;
     _mode_handler = NULL;
     _ncurrent_handler = 0;
+    _nqueued_titles = 0;
+    _title_stage = 0;
     _showing_title = false;
     _pending_display_update = false;
     _pending_realization_update = false;
@@ -21,12 +25,34 @@ void EventDispatcher::set_mode(int nhandler){
 
 void EventDispatcher::set_mode(HT16K33Disp *display, int nhandler){
     set_mode(nhandler);
-    // Start non-blocking title display
-    _showing_title = _mode_handler->begin_show_title(display);
+    // Start non-blocking title display, queued titles first
+    _title_stage = 0;
+    begin_next_title(display);
     _pending_display_update = true;
     _pending_realization_update = true;
 }
 
+void EventDispatcher::queue_title(const __FlashStringHelper *title, int show_delay, int scroll_delay){
+    if(_nqueued_titles >= MAX_QUEUED_TITLES)
+        return;
+    _queued_titles[_nqueued_titles] = title;
+    _queued_show_delays[_nqueued_titles] = show_delay;
+    _queued_scroll_delays[_nqueued_titles] = scroll_delay;
+    _nqueued_titles++;
+}
+
+void EventDispatcher::begin_next_title(HT16K33Disp *display){
+    if(_title_stage < _nqueued_titles){
+        // queued titles live in flash; the display keeps pointing at title_text_buffer while scrolling
+        char *title = load_f_string(_queued_titles[_title_stage], title_text_buffer);
+        display->begin_scroll_string(title, _queued_show_delays[_title_stage], _queued_scroll_delays[_title_stage]);
+        _showing_title = true;
+    } else {
+        _nqueued_titles = 0;
+        _showing_title = _mode_handler->begin_show_title(display);
+    }
+}
+
 //returns true if the event was consumed
 // some events are meta-events, for example to change modes
 bool EventDispatcher::dispatch_event(HT16K33Disp *display, int encoder_id, int event, int event_data){
@@ -90,6 +116,13 @@ bool EventDispatcher::step_title_display(HT16K33Disp *display) {
     }
     
     _showing_title = _mode_handler->step_show_title(display);
+
+    // Move from a queued title on to the next one, then the mode title
+    if (!_showing_title && _nqueued_titles) {
+        _title_stage++;
+        begin_next_title(display);
+        return _showing_title;
+    }
     
     // If title display just finished, handle pending updates
     if (!_showing_title) {
@@ -109,3 +142,9 @@ bool EventDispatcher::step_title_display(HT16K33Disp *display) {
 bool EventDispatcher::is_showing_title() const {
     return _showing_title;
 }
+
+void EventDispatcher::clear_titles() {
+    _nqueued_titles = 0;
+    _title_stage = 0;
+    _showing_title = false;
+}
@@ -0,0 +1,54 @@
+#include "fast_random.h"
+
+FastRandom fast_random;
+
+static uint32_t base_seed = 1;
+
+uint16_t FastRandom::below(uint16_t n){
+    uint32_t product = (uint32_t)(uint16_t)(next() >> 16) * n;
+    uint16_t low = (uint16_t)product;
+    if(low < n){
+        // Reject the (65536 % n) low values that would favor some results
+        uint16_t threshold = (uint16_t)(0x10000UL - n) % n;
+        while(low < threshold){
+            product = (uint32_t)(uint16_t)(next() >> 16) * n;
+            low = (uint16_t)product;
+        }
+    }
+    return (uint16_t)(product >> 16);
+}
+
+uint32_t FastRandom::below_long(uint32_t n){
+    if(n <= 0xFFFFUL)
+        return below((uint16_t)n);
+
+    uint64_t product = (uint64_t)next() * n;
+    uint32_t low = (uint32_t)product;
+    if(low < n){
+        uint32_t threshold = (uint32_t)(0x100000000ULL - n) % n;
+        while(low < threshold){
+            product = (uint64_t)next() * n;
+            low = (uint32_t)product;
+        }
+    }
+    return (uint32_t)(product >> 32);
+}
+
+void seed_fast_random(uint32_t seed_value){
+#ifdef FIXED_RANDOM_SEED
+    seed_value = FIXED_RANDOM_SEED;
+#endif
+    base_seed = seed_value;
+    fast_random.seed(fast_random_stream_seed(0));
+}
+
+// Spreads nearby stream numbers across the state space (murmur3 finalizer)
+uint32_t fast_random_stream_seed(byte stream){
+    uint32_t h = base_seed ^ ((stream + 1UL) * 0x9E3779B9UL);
+    h ^= h >> 16;
+    h *= 0x85EBCA6BUL;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35UL;
+    h ^= h >> 16;
+    return h;
+}
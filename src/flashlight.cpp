@@ -39,11 +39,12 @@ void Flashlight::prev_option(){
 
 void Flashlight::update_display(HT16K33Disp *display){
     if(option_flashlight == 0) {
-        sprintf(display_text_buffer, "OFF");
+        strcpy_P(display_text_buffer, PSTR("OFF"));
     } else {
-        sprintf(display_text_buffer, "FLuX %3d", option_flashlight);  // Right-align the number in 3 characters
+        strcpy_P(display_text_buffer, PSTR("FLuX "));
+        *format_uint(display_text_buffer + 5, option_flashlight, 3, ' ') = 0;  // Right-align the number in 3 characters
     }
-    display->scroll_string(display_text_buffer, 1, 1);
+    display->show_string(display_text_buffer);
 
     // Update signal meter LEDs to reflect current flashlight setting
     // This ensures the LEDs show the correct state when the option is first displayed
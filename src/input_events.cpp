@@ -0,0 +1,47 @@
+#include "input_events.h"
+
+InputEventRing input_events;
+
+InputEventRing::InputEventRing(){
+    _head = 0;
+    _tail = 0;
+    _dropped = 0;
+}
+
+bool InputEventRing::push(byte id, byte type, int8_t data, unsigned long time){
+    byte head = _head;
+    byte next = (head + 1) & (INPUT_EVENT_RING_SIZE - 1);
+    if(next == _tail){
+        if(_dropped < 255)
+            _dropped++;
+        return false;
+    }
+
+    InputEvent &event = _events[head];
+    event.id = id;
+    event.type = type;
+    event.data = data;
+    event.time = time;
+
+    // publish only after the event is complete; _events is not volatile, so the
+    // compiler barrier keeps the stores above from moving past the _head store
+    __asm__ __volatile__("" ::: "memory");
+    _head = next;
+    return true;
+}
+
+bool InputEventRing::pop(InputEvent &event){
+    byte tail = _tail;
+    if(tail == _head)
+        return false;
+
+    event = _events[tail];
+    // finish the copy before handing the slot back to the producer
+    __asm__ __volatile__("" ::: "memory");
+    _tail = (tail + 1) & (INPUT_EVENT_RING_SIZE - 1);
+    return true;
+}
+
+void InputEventRing::reset(){
+    _tail = _head;
+}
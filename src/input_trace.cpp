@@ -0,0 +1,91 @@
+#include "input_trace.h"
+
+#ifdef ENABLE_INPUT_TRACE
+
+InputTrace input_trace;
+
+InputTrace::InputTrace(){
+    _head = 0;
+    _tail = 0;
+    _last_time = 0;
+    _lost = 0;
+}
+
+void InputTrace::begin(unsigned long time){
+    const char *magic = INPUT_TRACE_MAGIC;
+    while(*magic)
+        put(*magic++);
+    for(byte i = 0; i < 4; i++)
+        put((byte)(time >> (8 * i)));
+    _last_time = time;
+}
+
+byte InputTrace::free_space() const {
+    return (byte)(_tail - _head - 1) & (INPUT_TRACE_RING_SIZE - 1);
+}
+
+void InputTrace::put(byte b){
+    byte head = _head;
+    _ring[head] = b;
+    _head = (head + 1) & (INPUT_TRACE_RING_SIZE - 1);
+}
+
+// all or nothing, so a full ring never leaves half a record
+bool InputTrace::write_record(byte kind, unsigned long time, byte value){
+    unsigned long delta = time - _last_time;
+
+    byte size = kind >= INPUT_TRACE_APP ? 2 : 1;
+    if(delta >= INPUT_TRACE_DELTA_ESCAPE){
+        for(unsigned long rest = delta; rest; rest >>= 7)
+            size++;
+    }
+    if(size > free_space())
+        return false;
+
+    if(delta < INPUT_TRACE_DELTA_ESCAPE){
+        put((kind << 4) | (byte)delta);
+    } else {
+        put((kind << 4) | INPUT_TRACE_DELTA_ESCAPE);
+        while(delta >= 0x80){
+            put((byte)delta | 0x80);
+            delta >>= 7;
+        }
+        put((byte)delta);
+    }
+    if(kind >= INPUT_TRACE_APP)
+        put(value);
+
+    _last_time = time;
+    return true;
+}
+
+void InputTrace::record(byte kind, unsigned long time, byte value){
+    // report a gap before the first record that fits again
+    if(_lost){
+        if(!write_record(INPUT_TRACE_LOST, time, _lost)){
+            if(_lost < 255)
+                _lost++;
+            return;
+        }
+        _lost = 0;
+    }
+    if(!write_record(kind, time, value))
+        _lost = 1;
+}
+
+void InputTrace::record_app(byte application, unsigned long time){
+    noInterrupts();
+    record(INPUT_TRACE_APP, time, application);
+    interrupts();
+}
+
+void InputTrace::send(){
+    int room = Serial.availableForWrite();
+    while(room-- > 0 && _tail != _head){
+        byte tail = _tail;
+        Serial.write(_ring[tail]);
+        _tail = (tail + 1) & (INPUT_TRACE_RING_SIZE - 1);
+    }
+}
+
+#endif // ENABLE_INPUT_TRACE
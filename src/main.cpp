@@ -7,9 +7,6 @@
 
 #include <MD_AD9833.h>
 
-#include <Encoder.h>
-#include <Adafruit_NeoPixel.h>
-
 #include "displays.h"
 
 #include "hardware.h"
@@ -19,6 +16,7 @@
 
 #include "saved_data.h"
 #include "seeding.h"
+#include "fast_random.h"
 
 #include "utils.h"
 
@@ -28,7 +26,12 @@
 
 #include "station_manager.h"
 
+#include "input_events.h"
 #include "encoder_handler.h"
+#include "input_trace.h"
+#include "profiler.h"
+#include "telemetry.h"
+#include "ram_monitor.h"
 
 #include "vfo.h"
 
@@ -96,9 +99,9 @@
 
 #include "wave_gen_pool.h"
 
-#ifdef USE_EEPROM_TABLES
-#include "eeprom_tables.h"
-#endif
+#include "static_realization_pool.h"
+
+#include "eeprom_tables.h"   // TABLE_STORAGE selects Flash, EEPROM or cached EEPROM tables
 
 #include "signal_meter.h"
 
@@ -112,6 +115,12 @@
 // ============================================================================
 #define ENABLE_BRANDING_MODE  // OPTIMIZATION: Disabled by default to save Flash
 
+// ============================================================================
+// LOOP STALL MEASUREMENT
+// Uncomment to print the longest main loop pass (microseconds) to Serial each second
+// ============================================================================
+// #define DEBUG_LOOP_STALL
+
 // Create an ledStrip object and specify the pin it will use.
 // Now using Adafruit NeoPixel for both platforms
 // PololuLedStrip<12> ledStrip;
@@ -164,135 +173,53 @@ WaveGenPool wave_gen_pool(wavegens, realizer_stats, 4);
 SignalMeter signal_meter;
 
 // ============================================================================
-// STATION CONFIGURATION - Conditional compilation based on station_config.h
+// STATION CONFIGURATION - Generated from STATION_TABLE in station_config.h
 // ============================================================================
 //
-// *** CRITICAL ARRAY SYNCHRONIZATION REQUIREMENTS ***
-//
-// When adding/removing stations or creating new configurations, you MUST update:
-//
-// 1. station_pool[SIZE] array declaration (match actual station count)
-// 2. realizations[SIZE] array declaration (must match station_pool size)  
-// 3. realization_stats[SIZE] array in conditional #ifdef block (lines ~590-602)
-// 4. RealizationPool constructor parameter (lines ~610-620)
-//
-// Example: CONFIG_MIXED_STATIONS currently has 3 stations:
-//   - station_pool[3] and realizations[3] (defined in config sections below)
-//   - realization_stats[3] (defined around line 597)
-//   - RealizationPool(..., 3) (defined around line 615)
-//
-// *** RESTART BUG WARNING ***
-// Mismatched array sizes cause continuous Arduino restarts!
-// Always verify station count matches ALL array declarations!
+// Everything below is expanded from the one table, so the station objects,
+// realizations[], realization_stats[], the pool and manager counts cannot
+// drift apart (the old "continuous restart" failure mode). The static_asserts
+// after the station manager catch an expansion that drops or adds an entry.
 //
 // ============================================================================
 
-#ifdef CONFIG_SIMDTMF
+#define DEFINE_TELCO_STATION(name, freq, type, boot) SimTelco name(&wave_gen_pool, &signal_meter, freq, TelcoType::type);
+#define DEFINE_DTMF_STATION(name, freq, boot) SimDTMF name(&wave_gen_pool, &signal_meter, freq);
+STATION_TABLE(DEFINE_TELCO_STATION, DEFINE_DTMF_STATION)
 
-// TEST: Single SimTelco station for testing duplicate class functionality
-SimDTMF cw_station2_test1(&wave_gen_pool, &signal_meter, 555123400L);
-SimDTMF cw_station2_test2(&wave_gen_pool, &signal_meter, 867530900L);
-
-SimDualTone *station_pool[2] = {  // Now using SimDualTone base class
-    &cw_station2_test1
-	,
-    &cw_station2_test2
-};
-
-Realization *realizations[2] = {  // Only 1 entry for test config
-	&cw_station2_test1
-	,
-	&cw_station2_test2
-};
-#endif
-
-#ifdef CONFIG_SIMTELCO
-
-// TEST: Single SimTelco station for testing duplicate class functionality
-SimTelco cw_station2_test1(&wave_gen_pool, &signal_meter, 55500000L, TelcoType::TELCO_DIALTONE);
-
-SimTelco cw_station2_test2(&wave_gen_pool, &signal_meter, 55501000L, TelcoType::TELCO_DIALTONE);
-
-SimDualTone *station_pool[2] = {  // Now using SimDualTone base class
-    &cw_station2_test1
-	,
-    &cw_station2_test2
+#define LIST_STATION(name, ...) &name,
+Realization *realizations[] = {
+	STATION_TABLE(LIST_STATION, LIST_STATION)
 };
 
-Realization *realizations[2] = {  // Only 1 entry for test config
-	&cw_station2_test1
-	,
-	&cw_station2_test2
+#define BOOT_STATE_TELCO(name, freq, type, boot) boot,
+#define BOOT_STATE_DTMF(name, freq, boot) boot,
+const StationState station_boot_states[] = {
+	STATION_TABLE(BOOT_STATE_TELCO, BOOT_STATE_DTMF)
 };
-#endif
-
-#ifdef CONFIG_ALLTELCO
-
-SimTelco cw_station2_test1(&wave_gen_pool, &signal_meter,  555123400L, TelcoType::TELCO_RINGBACK);
-SimDTMF cw_station2_test2(&wave_gen_pool, &signal_meter,   555130000L);
-SimTelco cw_station2_test3(&wave_gen_pool, &signal_meter,  555200000L, TelcoType::TELCO_DIALTONE);
-SimTelco cw_station2_test4(&wave_gen_pool, &signal_meter,  555250000L, TelcoType::TELCO_DIALTONE);
-SimTelco cw_station2_test5(&wave_gen_pool, &signal_meter,  555300000L, TelcoType::TELCO_RINGBACK);
-SimTelco cw_station2_test6(&wave_gen_pool, &signal_meter,  555350000L, TelcoType::TELCO_RINGBACK);
-SimDTMF cw_station2_test7(&wave_gen_pool, &signal_meter,   555400000L);
-SimDTMF cw_station2_test8(&wave_gen_pool, &signal_meter,   555500000L);
-SimTelco cw_station2_test9(&wave_gen_pool, &signal_meter,  555450000L, TelcoType::TELCO_BUSY);
-SimTelco cw_station2_test10(&wave_gen_pool, &signal_meter,  555550000L, TelcoType::TELCO_BUSY);
-// SimTelco cw_station2_test10(&wave_gen_pool, &signal_meter,  555550000L, TelcoType::TELCO_REORDER);
-SimDualTone *station_pool[10] = {
-    &cw_station2_test1,
-    &cw_station2_test2,
-    &cw_station2_test3,
-    &cw_station2_test4,
-    &cw_station2_test5,
-    &cw_station2_test6,
-    &cw_station2_test7,
-    &cw_station2_test8,
-	&cw_station2_test9,
-    &cw_station2_test10
-};
-
-Realization *realizations[10] = {  // Only 1 entry for test config
-    &cw_station2_test1,
-    &cw_station2_test2,
-    &cw_station2_test3,
-    &cw_station2_test4,
-    &cw_station2_test5,
-    &cw_station2_test6,
-    &cw_station2_test7,
-    &cw_station2_test8,
-    &cw_station2_test9,
-    &cw_station2_test10
-};
-#endif
-
 
 // ============================================================================
 // REALIZATION POOL - Initialize with configured realizations
 // ============================================================================
 
-#if defined(CONFIG_SIMDTMF) || defined(CONFIG_SIMTELCO)
-bool realization_stats[2] = {false, false};  // Single SimTelco test station
-#elif defined(CONFIG_ALLTELCO)
-bool realization_stats[10] = {false, false, false, false, false, false, false, false, false, false};  // Single SimTelco test station
-#endif
+bool realization_stats[STATION_COUNT] = {};  // All stations start free
 
-#if defined(CONFIG_SIMDTMF) || defined(CONFIG_SIMTELCO)
-RealizationPool realization_pool(realizations, realization_stats, 2);  // *** CRITICAL: Count must match arrays above! ***
-#elif defined(CONFIG_ALLTELCO)
-RealizationPool realization_pool(realizations, realization_stats, 10);  // *** CRITICAL: Count must match arrays above! ***
-#endif
+// RealizationPool, or the typed pool with ENABLE_STATIC_STATION_DISPATCH
+StationRealizationPool realization_pool(realizations, realization_stats, STATION_COUNT);
 
 // ============================================================================
 // STATION MANAGER - Initialize with shared realizations array (FluxTune optimization)
 // Memory savings: Eliminates duplicate station_pool[] array via inheritance casting
 // ============================================================================
 
-#if defined(CONFIG_SIMDTMF) || defined(CONFIG_SIMTELCO)
-StationManager station_manager(realizations, 2);  // Use optimized constructor with shared array
-#elif defined(CONFIG_ALLTELCO)
-StationManager station_manager(realizations, 10);  // Use optimized constructor with shared array
-#endif
+StationManager station_manager(realizations, STATION_COUNT);  // Use optimized constructor with shared array
+
+// Each array above is a separate expansion of STATION_TABLE; the pool and the manager
+// are handed STATION_COUNT and index them all with it
+static_assert(sizeof(realizations) / sizeof(realizations[0]) == STATION_COUNT, "realizations[] does not match STATION_TABLE");
+static_assert(sizeof(station_boot_states) / sizeof(station_boot_states[0]) == STATION_COUNT, "station_boot_states[] does not match STATION_TABLE");
+static_assert(sizeof(realization_stats) / sizeof(realization_stats[0]) == sizeof(realizations) / sizeof(realizations[0]), "realization_stats[] and realizations[] passed to the pool differ in size");
+static_assert(STATION_COUNT <= MAX_STATIONS, "StationManager cannot hold every station in STATION_TABLE");
 
 // Timer for periodic exchange signal randomization (authentic telephony behavior)
 unsigned long last_exchange_randomization = 0;
@@ -300,12 +227,20 @@ const unsigned long EXCHANGE_RANDOMIZE_INTERVAL = 30000;  // 30 seconds between
 
 // DEBUG: Station count verification (updated for FluxTune shared array optimization)
 void debug_station_pool_state() {
+#ifdef ENABLE_TELEMETRY
+    int valid = 0;
+    for(unsigned int i = 0; i < sizeof(realizations) / sizeof(realizations[0]); i++) {
+        if(realizations[i] != nullptr)
+            valid++;
+    }
+    TELEMETRY(TELEMETRY_POOL, valid, sizeof(realizations) / sizeof(realizations[0]));
+#else
     Serial.println("=== SHARED REALIZATIONS DEBUG ===");
     Serial.print("Array size (compile time): ");
     Serial.println(sizeof(realizations) / sizeof(realizations[0]));
     
     int actual_count = 0;
-    for(int i = 0; i < (sizeof(realizations) / sizeof(realizations[0])); i++) {
+    for(unsigned int i = 0; i < sizeof(realizations) / sizeof(realizations[0]); i++) {
         Serial.print("realizations[");
         Serial.print(i);
         Serial.print("] = ");
@@ -319,6 +254,7 @@ void debug_station_pool_state() {
     Serial.print("Valid stations: ");
     Serial.println(actual_count);
     Serial.println("=== END STATION DEBUG ===");
+#endif
 }
 
 VFO vfoa("EXC 555", 555123400L, 100, &realization_pool);
@@ -355,6 +291,9 @@ void setup_display(){
 	const byte display_brightnesses[] = {(unsigned char)option_contrast, (unsigned char)option_contrast};
 	display.init(display_brightnesses);
 	display.clear();
+
+	// Display updates are queued and sent from the main loop (display.service())
+	display.set_background_flush(true);
 }
 
 void setup_signal_meter(){
@@ -369,11 +308,24 @@ void setup_leds(){
 }
 
 void setup_buttons(){
+	encoder_handlerA.begin();
+	encoder_handlerB.begin();
 }
 
+void start_radio();
+
 void setup(){
 	Serial.begin(115200);
-	randomizer.randomize();
+#ifdef ENABLE_INPUT_TRACE
+	input_trace.begin(millis());
+#endif
+#ifdef ENABLE_PROFILER
+	profile_begin();
+#endif
+#ifdef ENABLE_TELEMETRY
+	telemetry.begin();
+#endif
+	seed_fast_random(randomizer.randomize());
 
 #ifdef USE_EEPROM_TABLES
 	// Initialize EEPROM tables if enabled
@@ -388,6 +340,8 @@ void setup(){
 
 	setup_leds();
 
+	setup_buttons();
+
 	setup_display();
 
 	setup_signal_meter();
@@ -418,6 +372,12 @@ void setup(){
 	// DEBUG: Check for station pool array bounds bug
 	debug_station_pool_state();
 
+	start_radio();
+
+#ifdef ENABLE_RAM_MONITOR
+	// after setup, so its deepest call (pipeline setup) is already counted
+	ram_monitor_begin();
+#endif
 }
 
 #ifdef ENABLE_BRANDING_MODE
@@ -427,7 +387,8 @@ void setup(){
 // Sets signal meter to full strength and lights panel LEDs at max brightness
 // ============================================================================
 void activate_branding_mode() {
-	Adafruit_NeoPixel* led_strip = nullptr;
+	display.show_string(FSTR("FLuXTeLE"));
+	display.flush();
 
 	// Keep display showing "FluxTune" from previous code - perfect for branding photos!
       // Directly set signal meter LEDs to 4x brightness (bypass dynamic system)
@@ -456,22 +417,10 @@ static const uint32_t BRAND_COLORS[SignalMeter::LED_COUNT] = {
 };
 #endif
 
-	led_strip = new Adafruit_NeoPixel(SignalMeter::LED_COUNT, SIGNAL_METER_PIN, NEO_GRB + NEO_KHZ800);
-	led_strip->begin();
-	led_strip->clear();
-	led_strip->show();
-	
 	// Enter infinite loop for photography - device stays in perfect display state
 	while(true) {
-		for(int i = 0; i < SignalMeter::LED_COUNT; i++){
-			uint32_t color = BRAND_COLORS[i];
-			// uint8_t r = (color >> 16) & 0xFF;
-			// uint8_t g = (color >> 8) & 0xFF;
-			// uint8_t b = color & 0xFF;
-			// led_strip->setPixelColor(i, led_strip->Color(r, g, b));
-			led_strip->setPixelColor(i, color);
-		}
-		led_strip->show();
+		// The signal meter's strip drives the same LEDs
+		signal_meter.show_colors(BRAND_COLORS);
 
 		// Keep signal meter LEDs at full brightness (handled by SignalMeter class now)
         // Keep both panel LEDs at 4x maximum brightness
@@ -486,20 +435,30 @@ static const uint32_t BRAND_COLORS[SignalMeter::LED_COUNT] = {
 
 EventDispatcher * set_application(int application, HT16K33Disp *display){
 	EventDispatcher *dispatcher;
-	char *title;	switch(application){
+	const __FlashStringHelper *title;	switch(application){
 		case APP_SIMRADIO:
 			dispatcher = &dispatcher1;
 			current_dispatcher = APP_SIMRADIO;
-			title = (FSTR("SimTelco"));
+			title = F("SimTelco");
 		break;
 
 		case APP_SETTINGS:
+		default:
 			dispatcher = &dispatcher3;
 			current_dispatcher = APP_SETTINGS;
-			title = (FSTR("Settings"));
+			title = F("Settings");
 		break;	}
-	display->scroll_string(title, DISPLAY_SHOW_TIME, DISPLAY_SCROLL_TIME);
 
+#ifdef ENABLE_INPUT_TRACE
+	input_trace.record_app(current_dispatcher, millis());
+#endif
+
+	// Titles left queued on the application being left (a switch during the boot
+	// splash) would otherwise play again, and fill the queue, on its next return
+	(dispatcher == &dispatcher1 ? dispatcher3 : dispatcher1).clear_titles();
+
+	// Application title scrolls ahead of the mode title without blocking the main loop
+	dispatcher->queue_title(title, DISPLAY_SHOW_TIME, DISPLAY_SCROLL_TIME);
 	dispatcher->set_mode(display, 0);
 	
 	// Force realization update when switching to SimRadio to ensure audio resumes immediately
@@ -511,15 +470,41 @@ EventDispatcher * set_application(int application, HT16K33Disp *display){
 }
 
 void purge_events(){
-	// Clear all pending encoder events
-	while(encoder_handlerA.changed() || encoder_handlerB.changed() || 
-	      encoder_handlerA.pressed() || encoder_handlerA.long_pressed() ||
-	      encoder_handlerB.pressed() || encoder_handlerB.long_pressed());
+	// Discard captured encoder events (noise/overshoot after a mode or application change)
+	input_events.reset();
+	encoder_handlerA.reset();
+	encoder_handlerB.reset();
 }
 
-void loop()
+// Frame-based tuning updates: encoder events only move the VFO model, and the display,
+// signal meter and realization (AD9833 SPI writes) catch up at most once per frame,
+// however fast the knob turns
+#define TUNING_FRAME_INTERVAL 20    // milliseconds (50 frames per second)
+bool tuning_frame_pending = false;
+unsigned long next_tuning_frame = 0;
+
+// Display, signal meter and realization updates for the latest VFO state
+void update_after_tuning(){
+	PROFILE_SCOPE("frame");
+
+	#ifdef ENABLE_TELEMETRY
+	Mode* current_mode = dispatcher->get_current_mode();
+	if (current_mode && dispatcher == &dispatcher1) {
+		VFO* current_vfo = static_cast<VFO*>(current_mode);
+		TELEMETRY(TELEMETRY_VFO, 0, current_vfo->_frequency);
+	}
+	#endif
+
+	dispatcher->update_display(&display);
+	dispatcher->update_signal_meter(&signal_meter);
+	dispatcher->update_realization();
+}
+
+// Starts the stations and the SimTelco application; the last step of setup()
+void start_radio()
 {
-	display.scroll_string(FSTR("FLuXTeLE"), DISPLAY_SHOW_TIME, DISPLAY_SCROLL_TIME);
+	// Splash scrolls ahead of the application title once the main loop is running
+	dispatcher1.queue_title(F("FLuXTeLE"), DISPLAY_SHOW_TIME, DISPLAY_SCROLL_TIME);
 
 #ifdef ENABLE_BRANDING_MODE
     // BRANDING MODE EASTER EGG - Check if encoder A button is pressed during startup
@@ -537,145 +522,179 @@ void loop()
 	// INITIALIZE 12-STATION DYNAMIC POOL	// Start stations based on configuration
 	// ============================================================================
 	
-#if defined(CONFIG_SIMDTMF) || defined(CONFIG_SIMTELCO)
-	cw_station2_test1.begin(time + random(1000));
-	cw_station2_test1.set_station_state(AUDIBLE);
-	cw_station2_test2.begin(time + random(2000));
-	cw_station2_test2.set_station_state(AUDIBLE);
-#endif
+	// Start the stations marked AUDIBLE in STATION_TABLE, staggered by a second each
+	// in table order; DORMANT ones are left for the pipeline
+	for(int i = 0; i < STATION_COUNT; i++){
+		SimDualTone *station = station_manager.getStation(i);
+		station->seed_random(i + 1);
+		if(station_boot_states[i] != AUDIBLE)
+			continue;
+		station->begin(time + fast_random.below((i + 1) * 1000U));
+		station->set_station_state(AUDIBLE);
+	}
+
+	set_application(APP_SIMRADIO, &display);
+}
 
-#if defined(CONFIG_ALLTELCO)
-	cw_station2_test1.begin(time + random(1000));
-	cw_station2_test1.set_station_state(AUDIBLE);
-	cw_station2_test2.begin(time + random(2000));
-	cw_station2_test2.set_station_state(AUDIBLE);
-	cw_station2_test3.begin(time + random(3000));
-	cw_station2_test3.set_station_state(AUDIBLE);
-	cw_station2_test4.begin(time + random(4000));
-	cw_station2_test4.set_station_state(AUDIBLE);
-	cw_station2_test5.begin(time + random(5000));
-	cw_station2_test5.set_station_state(AUDIBLE);
-	cw_station2_test6.begin(time + random(6000));
-	cw_station2_test6.set_station_state(AUDIBLE);
-	cw_station2_test7.begin(time + random(7000));
-	cw_station2_test7.set_station_state(AUDIBLE);
-	cw_station2_test8.begin(time + random(8000));
-	cw_station2_test8.set_station_state(AUDIBLE);
-	// cw_station2_test9.begin(time + random(9000));
-	// cw_station2_test9.set_station_state(AUDIBLE);
-	// cw_station2_test10.begin(time + random(10000));
-	// cw_station2_test10.set_station_state(AUDIBLE);
+void loop()
+{
+#ifdef ENABLE_PROFILER
+	profile_service();
+#endif
+	PROFILE_SCOPE("loop");
+
+	unsigned long time = millis();
+
+#ifdef DEBUG_LOOP_STALL
+	// Longest main loop pass, reported once a second
+	static unsigned long last_pass_us = micros();
+	static unsigned long worst_pass_us = 0;
+	static unsigned long next_stall_report = 0;
+	unsigned long pass_us = micros();
+	if(pass_us - last_pass_us > worst_pass_us)
+		worst_pass_us = pass_us - last_pass_us;
+	last_pass_us = pass_us;
+	if(time >= next_stall_report){
+		Serial.print("STALL us: ");
+		Serial.println(worst_pass_us);
+		worst_pass_us = 0;
+		next_stall_report = time + 1000;
+	}
 #endif
 
-	set_application(APP_SIMRADIO, &display);
+	// Send at most one display chip of queued segment changes per pass
+	{
+		PROFILE_SCOPE("display");
+		display.service();
+	}
+
+#ifdef ENABLE_INPUT_TRACE
+	input_trace.send();
+#endif
+#ifdef ENABLE_TELEMETRY
+	telemetry.send();
+#endif
+#ifdef ENABLE_RAM_MONITOR
+	ram_monitor_service(time);
+#endif
 
-	while(true){
-		unsigned long time = millis();
-				// Update signal meter decay (capacitor-like discharge)
+	// Commit changed settings to EEPROM once they have been idle
+	step_save_data(time);
+	// Update signal meter decay (capacitor-like discharge)
+	{
+		PROFILE_SCOPE("signal meter");
 		signal_meter.update(time);
-		
-		// Update StationManager with current VFO frequency
-		// Only update when in VFO mode (dispatcher1)
-		if (dispatcher == &dispatcher1) {
-			Mode* current_mode = dispatcher->get_current_mode();
-			if (current_mode) {
-				// We know this is a VFO since we're in dispatcher1
-				// Use static_cast since we've verified the type through dispatcher check
-				VFO* current_vfo = static_cast<VFO*>(current_mode);
-				station_manager.updateStations(current_vfo->_frequency);
-			}
+	}
+	
+	// Update StationManager with current VFO frequency
+	// Only update when in VFO mode (dispatcher1)
+	if (dispatcher == &dispatcher1) {
+		Mode* current_mode = dispatcher->get_current_mode();
+		if (current_mode) {
+			// We know this is a VFO since we're in dispatcher1
+			// Use static_cast since we've verified the type through dispatcher check
+			VFO* current_vfo = static_cast<VFO*>(current_mode);
+			PROFILE_SCOPE("stations");
+			station_manager.updateStations(current_vfo->_frequency);
 		}
-		
-		// Periodic exchange signal randomization for realistic telephony behavior
-		// --- PANEL LOCK LED OVERRIDE ---
-        int lock_brightness = signal_meter.get_panel_led_brightness();
-        if (lock_brightness > 0) {
-            int pwm = (lock_brightness * PANEL_LOCK_LED_FULL_BRIGHTNESS) / (255 * PANEL_LED_BRIGHTNESS_DIVISOR);
-            analogWrite(WHITE_PANEL_LED, pwm); // White LED lock indicator
-        } else {
-            analogWrite(WHITE_PANEL_LED, 0);
-        }        // Comment out the old animation:
+	}
+	
+	// Periodic exchange signal randomization for realistic telephony behavior
+	// --- PANEL LOCK LED OVERRIDE ---
+    int lock_brightness = signal_meter.get_panel_led_brightness();
+    if (lock_brightness > 0) {
+        int pwm = (lock_brightness * PANEL_LOCK_LED_FULL_BRIGHTNESS) / (255 * PANEL_LED_BRIGHTNESS_DIVISOR);
+        analogWrite(WHITE_PANEL_LED, pwm); // White LED lock indicator
+    } else {
+        analogWrite(WHITE_PANEL_LED, 0);
+    }        // Comment out the old animation:
+	{
+		PROFILE_SCOPE("realizations");
 		realization_pool.step(time);
+	}
 
-		// NOTE: Station step() calls are handled automatically by realization_pool.step()
-		// No need for manual step() calls - RealizationPool architecture handles this
+	// NOTE: Station step() calls are handled automatically by realization_pool.step()
+	// No need for manual step() calls - RealizationPool architecture handles this
 
-		encoder_handlerA.step();
-		encoder_handlerB.step();
+	{
+		PROFILE_SCOPE("encoders");
+		encoder_handlerA.step(time);
+		encoder_handlerB.step(time);
+	}
 
-		// Step non-blocking title display if active
+	// Step non-blocking title display if active
+	{
+		PROFILE_SCOPE("title");
 		dispatcher->step_title_display(&display);
+	}
 
-		// check for changing dispatchers
-		bool pressed = encoder_handlerB.pressed();
-		bool long_pressed = encoder_handlerB.long_pressed();
-		if(pressed || long_pressed){
-			if(pressed){
-				// char *title;
-				switch(current_dispatcher){
-					case 1:
-						// 
-						dispatcher = set_application(APP_SETTINGS, &display); // Go to Settings
-						// current_dispatcher = 2;
-						// title = (FSTR("AudioOut"));
-						break;
-						
-					case 2:
-						// Clear flashlight mode when leaving settings
-						signal_meter.clear_flashlight_mode();
-						// 
-						dispatcher = set_application(APP_SIMRADIO, &display); // &dispatcher1;
-						// current_dispatcher = 1;
-						// title = (FSTR("SimRadio"));
-						break;
-				}
-
-				purge_events();
+	// Drain captured encoder and button events in the order they happened
+	// Every detent is dispatched; display and realization updates are coalesced per pass
+	bool tuned = false;
+	InputEvent event;
+	while(input_events.pop(event)){
+		if(event.id == ID_ENCODER_TUNING){
+			if(event.type == INPUT_EVENT_PRESS){
+				PROFILE_SCOPE("tune press");
+				encoder_handlerA.button_pressed(event.time);
+				dispatcher->dispatch_event(&display, ID_ENCODER_TUNING, true, false);
+			} else if(!dispatcher->is_showing_title()){
+				PROFILE_SCOPE("tune");
+				// Rotation is ignored while showing a title
+				// event_data carries the detent time for VFO_Tuner acceleration
+				dispatcher->dispatch_event(&display, ID_ENCODER_TUNING, (int)event.data, (int)event.time);
+				tuned = true;
 			}
+			continue;
 		}
-		// Always check encoder state to keep internal driver logic running
-		bool encoderA_changed = encoder_handlerA.changed();
-		bool encoderB_changed = encoder_handlerB.changed();
-		
-		// Process encoder events only when not showing title (to prevent missed events)
-		if (!dispatcher->is_showing_title()) {
-			if(encoderA_changed){
-				#ifdef DEBUG_PIPELINING
-				// Minimal tuning debug - only show frequency changes
-				Mode* current_mode = dispatcher->get_current_mode();
-				if (current_mode && dispatcher == &dispatcher1) {
-					VFO* current_vfo = static_cast<VFO*>(current_mode);
-					Serial.print("VFO: ");
-					Serial.println(current_vfo->_frequency);
-				}
-				#endif
-				
-				dispatcher->dispatch_event(&display, ID_ENCODER_TUNING, encoder_handlerA.diff(), 0);
-				dispatcher->update_display(&display);
-				dispatcher->update_signal_meter(&signal_meter);
-				
-				// // Test: Add StationManager call in encoder A handling (where the problem occurred)
-				// station_manager.updateStations(7000000);
-				
-				dispatcher->update_realization();
-			}
 
-			if(encoderB_changed){
-				dispatcher->dispatch_event(&display, ID_ENCODER_MODES, encoder_handlerB.diff(), 0);
-				purge_events();  // Clear any noise/overshoot after mode change
-				
-				// Note: No immediate update_display() call here - let show_title() finish first
-				dispatcher->update_realization();
-			}
+		// Bring the current application up to date before mode or application changes
+		if(tuned || tuning_frame_pending){
+			update_after_tuning();
+			tuned = false;
+			tuning_frame_pending = false;
 		}
-		// Note: If showing title, encoder changes are detected but ignored - 
-		// this keeps the encoder driver state machine running properly
 
-		pressed = encoder_handlerA.pressed();
-		long_pressed = encoder_handlerA.long_pressed();
-		if(pressed || long_pressed){
-			dispatcher->dispatch_event(&display, ID_ENCODER_TUNING, pressed, long_pressed);
+		if(event.type == INPUT_EVENT_PRESS){
+			PROFILE_SCOPE("app switch");
+			// check for changing dispatchers
+			switch(current_dispatcher){
+				case APP_SIMRADIO:
+					dispatcher = set_application(APP_SETTINGS, &display); // Go to Settings
+					break;
+					
+				case APP_SETTINGS:
+					// Save changed settings and clear flashlight mode when leaving settings
+					commit_save_data();
+					signal_meter.clear_flashlight_mode();
+					dispatcher = set_application(APP_SIMRADIO, &display);
+					break;
+			}
+			purge_events();
+			break;
+		} else if(!dispatcher->is_showing_title()){
+			PROFILE_SCOPE("mode");
+			dispatcher->dispatch_event(&display, ID_ENCODER_MODES, (int)event.data, 0);
+			purge_events();  // Clear any noise/overshoot after mode change
+			
+			// Note: No immediate update_display() call here - let the title finish first
+			dispatcher->update_realization();
+			break;
 		}
 	}
+	// Tuning only changed the VFO model; apply it at most once per frame
+	if(tuned)
+		tuning_frame_pending = true;
+	if(tuning_frame_pending && (long)(time - next_tuning_frame) >= 0){
+		update_after_tuning();
+		tuning_frame_pending = false;
+		next_tuning_frame = time + TUNING_FRAME_INTERVAL;
+	}
 
+	// Encoder A button held: repeat as long press
+	if(encoder_handlerA.long_pressed()){
+		PROFILE_SCOPE("long press");
+		dispatcher->dispatch_event(&display, ID_ENCODER_TUNING, false, true);
+	}
 }
+
@@ -28,11 +28,6 @@ bool ModeHandler::event_sink(bool pressed, bool long_pressed){
 
 
 
-void ModeHandler::show_title(HT16K33Disp *display){
-    display->scroll_string(_mode->_title);
-    // update_display(display);
-}
-
 bool ModeHandler::begin_show_title(HT16K33Disp *display) {
     // Start non-blocking scroll for the title
     display->begin_scroll_string(_mode->_title);
@@ -1,6 +1,6 @@
-
 #include "option.h"
 #include "option_handler.h"
+#include "saved_data.h"
 
 Option_Handler::Option_Handler(Mode * mode) : ModeHandler(mode)
 {
@@ -19,6 +19,9 @@ bool Option_Handler::event_sink(int event, int event_data){
         option->prev_option();
     }
 
+    // Committed to EEPROM once the setting stops changing
+    mark_save_data_dirty();
+
     return true;
 }
 // JH! 
@@ -0,0 +1,118 @@
+#include "profiler.h"
+#include "input_trace.h"
+#include "utils.h"
+
+#ifdef ENABLE_PROFILER
+
+#ifdef ENABLE_INPUT_TRACE
+#error "ENABLE_PROFILER and ENABLE_INPUT_TRACE both use Serial"
+#endif
+
+#define PROFILE_COMMAND_PRINT 'p'
+#define PROFILE_OVERHEAD_SCOPES 16
+
+static ProfileSlot *profile_slots = nullptr;
+static ProfileSlot *profile_last = nullptr;
+static unsigned long profile_interval_start = 0;
+static uint32_t profile_overhead = 0;      // ticks per empty scope, x PROFILE_OVERHEAD_SCOPES
+
+void profile_record(ProfileSlot &slot, profile_ticks_t start, unsigned long start_ms){
+    uint32_t ticks = (profile_ticks_t)(PROFILE_TICKS() - start);
+#ifdef PROFILE_WRAP_MS
+    unsigned long ms = millis() - start_ms;
+    if(ms >= PROFILE_WRAP_MS)
+        ticks = ms * 1000UL * PROFILE_TICKS_PER_US;
+#endif
+
+    // slots print in the order they first ran
+    if(!slot.linked){
+        slot.linked = true;
+        if(profile_last)
+            profile_last->next = &slot;
+        else
+            profile_slots = &slot;
+        profile_last = &slot;
+    }
+
+    slot.calls++;
+    slot.total += ticks;
+    if(ticks > slot.longest)
+        slot.longest = ticks;
+}
+
+void profile_begin(){
+#ifdef PROFILE_TIMER
+    PROFILE_TIMER.CTRLA = 0;
+    PROFILE_TIMER.CTRLB = TCB_CNTMODE_INT_gc;   // count 0..CCMP and wrap, no interrupt
+    PROFILE_TIMER.INTCTRL = 0;
+    PROFILE_TIMER.CCMP = 0xFFFF;
+    PROFILE_TIMER.CNT = 0;
+    PROFILE_TIMER.CTRLA = TCB_CLKSEL_CLKDIV2_gc | TCB_ENABLE_bm;
+#endif
+
+    // a slot marked linked stays out of the printed list
+    ProfileSlot probe = {nullptr, nullptr, true, 0, 0, 0};
+    for(byte i = 0; i < PROFILE_OVERHEAD_SCOPES; i++){
+        ProfileScope scope(probe);
+    }
+    profile_overhead = probe.total;
+    profile_interval_start = millis();
+}
+
+void profile_service(){
+    if(Serial.available() && Serial.read() == PROFILE_COMMAND_PRINT)
+        profile_print();
+}
+
+// value in ticks as microseconds with one decimal, right-aligned
+static void print_us(uint32_t ticks, byte width){
+    uint32_t tenths = ticks / PROFILE_TICKS_PER_US * 10 + ticks % PROFILE_TICKS_PER_US * 10 / PROFILE_TICKS_PER_US;
+    char text[14];
+    char *p = format_ulong(text, tenths / 10);
+    *p++ = '.';
+    *p++ = '0' + tenths % 10;
+    *p = '\0';
+    for(byte n = strlen(text); n < width; n++)
+        Serial.print(' ');
+    Serial.print(text);
+}
+
+static void print_count(uint32_t value, byte width){
+    char text[12];
+    *format_ulong(text, value) = '\0';
+    for(byte n = strlen(text); n < width; n++)
+        Serial.print(' ');
+    Serial.print(text);
+}
+
+void profile_print(){
+    unsigned long now = millis();
+
+    Serial.print(F("PROFILE "));
+    Serial.print(now - profile_interval_start);
+    Serial.print(F(" ms, scope overhead "));
+    print_us(profile_overhead / PROFILE_OVERHEAD_SCOPES, 0);
+    Serial.println(F(" us"));
+    Serial.println(F("scope                calls      total us     mean us      max us"));
+
+    for(ProfileSlot *slot = profile_slots; slot; slot = slot->next){
+        const __FlashStringHelper *name = (const __FlashStringHelper *)slot->name;
+        byte length = strlen_P(slot->name);
+        Serial.print(name);
+        for(byte n = length; n < 16; n++)
+            Serial.print(' ');
+        print_count(slot->calls, 10);
+        print_us(slot->total, 14);
+        print_us(slot->calls ? slot->total / slot->calls : 0, 12);
+        print_us(slot->longest, 12);
+        Serial.println();
+
+        slot->calls = 0;
+        slot->total = 0;
+        slot->longest = 0;
+    }
+
+    profile_interval_start = millis();
+}
+
+#endif // ENABLE_PROFILER
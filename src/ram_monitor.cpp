@@ -0,0 +1,97 @@
+#include "ram_monitor.h"
+#include "input_trace.h"
+#include "telemetry.h"
+
+#ifdef ENABLE_RAM_MONITOR
+
+#ifdef ENABLE_INPUT_TRACE
+#error "ENABLE_RAM_MONITOR prints to Serial, which ENABLE_INPUT_TRACE needs to itself"
+#endif
+
+#if defined(__AVR__) && !defined(NATIVE_BUILD)
+
+// linker symbols
+extern uint8_t __data_start;
+extern uint8_t _end;                // end of .bss and .noinit
+extern uint8_t __stack;             // top of RAM
+
+// Runs from .init3: the stack pointer is at the top of RAM and nothing has been
+// pushed yet, so everything from _end to just below __stack can be painted. .data
+// and .bss are set up afterwards in .init4 and never reach past _end.
+void ram_paint() __attribute__((naked, used, section(".init3")));
+void ram_paint()
+{
+    __asm__ volatile(
+        "    ldi r30, lo8(_end)\n"
+        "    ldi r31, hi8(_end)\n"
+        "    ldi r24, %0\n"
+        "    ldi r25, hi8(__stack)\n"
+        "    rjmp 2f\n"
+        "1:  st Z+, r24\n"
+        "2:  cpi r30, lo8(__stack)\n"
+        "    cpc r31, r25\n"
+        "    brlo 1b\n"
+        :: "M"(RAM_CANARY));
+}
+
+unsigned int ram_static_bytes(){
+    return &_end - &__data_start;
+}
+
+unsigned int ram_stack_free_min(){
+    const uint8_t *p = &_end;
+    while(p < &__stack && *p == RAM_CANARY)
+        p++;
+    return p - &_end;
+}
+
+#else
+
+unsigned int ram_static_bytes(){
+    return 0;
+}
+
+unsigned int ram_stack_free_min(){
+    return 0;
+}
+
+#endif
+
+static unsigned int ram_reported_free = 0xFFFF;
+static unsigned long ram_next_scan = 0;
+
+static void report_stack(unsigned int bytes){
+#ifdef ENABLE_TELEMETRY
+    TELEMETRY(TELEMETRY_RAM, TELEMETRY_RAM_STACK, bytes);
+#else
+    Serial.print(F("RAM stack free min "));
+    Serial.println(bytes);
+#endif
+}
+
+void ram_monitor_begin(){
+    unsigned int static_bytes = ram_static_bytes();
+#ifdef ENABLE_TELEMETRY
+    TELEMETRY(TELEMETRY_RAM, TELEMETRY_RAM_STATIC, static_bytes);
+#else
+    Serial.print(F("RAM static "));
+    Serial.println(static_bytes);
+#endif
+    ram_reported_free = ram_stack_free_min();
+    report_stack(ram_reported_free);
+    ram_next_scan = millis() + RAM_MONITOR_INTERVAL;
+}
+
+void ram_monitor_service(unsigned long time){
+    if((long)(time - ram_next_scan) < 0)
+        return;
+    ram_next_scan = time + RAM_MONITOR_INTERVAL;
+
+    unsigned int bytes = ram_stack_free_min();
+    if(bytes < ram_reported_free){
+        ram_reported_free = bytes;
+        report_stack(bytes);
+    }
+}
+
+#endif // ENABLE_RAM_MONITOR
@@ -1,19 +1,43 @@
 #include "../include/basic_types.h"
 #include <EEPROM.h>
+#include <stddef.h>
 #include "../include/saved_data.h"
 
 int option_contrast = DEFAULT_CONTRAST;
 int option_bfo_offset = DEFAULT_BFO_OFFSET;
 int option_flashlight = DEFAULT_FLASHLIGHT;
 
+static byte save_data_slot = 0;			// slot holding the current record
+static byte save_data_sequence = 0;
+static bool save_data_dirty = false;
+static unsigned long save_data_dirty_time = 0;
+
+// newer in wrapping byte sequence order
+static bool sequence_newer(byte a, byte b){
+	return (signed char)(a - b) > 0;
+}
+
 void load_save_data(){
-	SavedData saved_data;
-	EEPROM.get(0, saved_data);
+	SavedData saved_data = {};
+	bool found = false;
 
-	if(saved_data.version != SAVE_DATA_VERSION){
+	for(byte slot = 0; slot < SAVE_DATA_SLOTS; slot++){
+		SavedData candidate;
+		EEPROM.get(slot * sizeof(SavedData), candidate);
+		if(candidate.version != SAVE_DATA_VERSION)
+			continue;
+		if(!found || sequence_newer(candidate.sequence, saved_data.sequence)){
+			saved_data = candidate;
+			save_data_slot = slot;
+			found = true;
+		}
+	}
+
+	if(!found){
 		reset_options();
 		return;
 	}
+	save_data_sequence = saved_data.sequence;
 	option_contrast = saved_data.option_contrast;
 	option_bfo_offset = saved_data.option_bfo_offset;
 	option_flashlight = saved_data.option_flashlight;
@@ -21,12 +45,44 @@ void load_save_data(){
 	// ##DATA Load new persisted play data variables into memory here
 }
 
+// writes the record to the next slot, touching only bytes that differ from what is there
+// the sequence byte goes last, so an interrupted write leaves the previous slot current
 void save_data(){	SavedData saved_data;	saved_data.version = SAVE_DATA_VERSION;
 	saved_data.option_contrast = option_contrast;
 	saved_data.option_bfo_offset = option_bfo_offset;
 	saved_data.option_flashlight = option_flashlight;
+	saved_data.sequence = save_data_sequence + 1;
+
+	byte slot = save_data_slot + 1;
+	if(slot >= SAVE_DATA_SLOTS)
+		slot = 0;
+
+	int address = slot * sizeof(SavedData);
+	const byte *bytes = (const byte *)&saved_data;
+	for(byte i = 0; i < sizeof(SavedData); i++){
+		if(i != offsetof(SavedData, sequence))
+			EEPROM.update(address + i, bytes[i]);
+	}
+	EEPROM.update(address + offsetof(SavedData, sequence), saved_data.sequence);
+
+	save_data_slot = slot;
+	save_data_sequence = saved_data.sequence;
+	save_data_dirty = false;
+}
+
+void mark_save_data_dirty(){
+	save_data_dirty = true;
+	save_data_dirty_time = millis();
+}
+
+void step_save_data(unsigned long time){
+	if(save_data_dirty && time - save_data_dirty_time >= SAVE_DATA_IDLE_TIME)
+		save_data();
+}
 
-	EEPROM.put(0, saved_data);
+void commit_save_data(){
+	if(save_data_dirty)
+		save_data();
 }
 
 typedef void (*VoidFunc)(void);
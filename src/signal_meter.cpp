@@ -1,29 +1,67 @@
 #include "signal_meter.h"
 #include "hardware.h"
 
-#ifdef ENABLE_LOGARITHMIC_S_METER
 #ifndef NATIVE_BUILD
-#include <math.h>  // For log2f() function
-#else
-#include <cmath>   // For log2f() function in native builds
-#endif
-#endif
+#include "static_neopixel.h"
 
-#ifndef NATIVE_BUILD
-// For both platforms - using Adafruit NeoPixel
-Adafruit_NeoPixel* SignalMeter::_led_strip = nullptr;
+// Pixel buffer in static storage: the signal meter never touches the heap
+static StaticNeoPixelStrip<SignalMeter::LED_COUNT, NEO_GRB + NEO_KHZ800> led_strip(SIGNAL_METER_PIN);
 extern int option_contrast;         // Defined in main.cpp (matches saved_data.cpp type)
 
-// Color values for NeoPixel (red, green, blue ordering)
-static const uint32_t LED_COLORS_NEOPIXEL[SignalMeter::LED_COUNT] = {
-    0x000F00,   // Green
-    0x000F00,   // Green  
-    0x000F00,   // Green
-    0x000F00,   // Green
-    0x0F0F00,   // Yellow
-    0x0F0F00,   // Yellow
-    0x0F0000    // Red
+// Color channels for NeoPixel (red, green, blue ordering)
+// Each lit channel runs at LED_FULL_LEVEL, e.g. green = 0x000F00 at full brightness
+static const uint32_t LED_CHANNELS_NEOPIXEL[SignalMeter::LED_COUNT] = {
+    0x000100,   // Green
+    0x000100,   // Green  
+    0x000100,   // Green
+    0x000100,   // Green
+    0x010100,   // Yellow
+    0x010100,   // Yellow
+    0x010000    // Red
 };
+static const uint8_t LED_FULL_LEVEL = 0x0F;
+
+// Strength (0-255) to LED pattern: high nibble = lit LEDs (1-7), low nibble = partial
+// brightness of the last lit LED (0-15). Generated by utils/signal_meter_table.py
+#ifdef ENABLE_LOGARITHMIC_S_METER
+const uint8_t STRENGTH_TO_LEDS[256] PROGMEM = {
+    0x10, 0x17, 0x19, 0x1B, 0x1E, 0x1F, 0x21, 0x22, 0x23, 0x25, 0x25, 0x27, 0x28, 0x28, 0x29, 0x2A,
+    0x2C, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x30, 0x31, 0x32, 0x33, 0x33, 0x34, 0x34, 0x35, 0x36, 0x37,
+    0x37, 0x37, 0x38, 0x39, 0x3A, 0x3A, 0x3A, 0x3B, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F,
+    0x40, 0x41, 0x41, 0x41, 0x42, 0x42, 0x43, 0x43, 0x44, 0x44, 0x45, 0x45, 0x45, 0x46, 0x46, 0x47,
+    0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E,
+    0x4E, 0x4F, 0x4F, 0x4F, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x53,
+    0x54, 0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x59,
+    0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5F, 0x5F, 0x5F, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x63, 0x63,
+    0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6C, 0x6C, 0x6C,
+    0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74,
+    0x74, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78,
+    0x78, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F,
+};
+#else
+const uint8_t STRENGTH_TO_LEDS[256] PROGMEM = {
+    0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 0x13, 0x14, 0x14, 0x15, 0x15, 0x16, 0x16,
+    0x17, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D,
+    0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x20, 0x20, 0x21, 0x21, 0x21, 0x22, 0x22, 0x23, 0x23, 0x24, 0x24,
+    0x25, 0x25, 0x25, 0x26, 0x26, 0x27, 0x27, 0x28, 0x28, 0x28, 0x29, 0x29, 0x2A, 0x2A, 0x2B, 0x2B,
+    0x2C, 0x2C, 0x2C, 0x2D, 0x2D, 0x2E, 0x2E, 0x2F, 0x2F, 0x30, 0x30, 0x30, 0x31, 0x31, 0x32, 0x32,
+    0x33, 0x33, 0x33, 0x34, 0x34, 0x35, 0x35, 0x36, 0x36, 0x37, 0x37, 0x37, 0x38, 0x38, 0x39, 0x39,
+    0x3A, 0x3A, 0x3A, 0x3B, 0x3B, 0x3C, 0x3C, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40,
+    0x41, 0x41, 0x41, 0x42, 0x42, 0x43, 0x43, 0x44, 0x44, 0x45, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47,
+    0x48, 0x48, 0x48, 0x49, 0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4E, 0x4E,
+    0x4F, 0x4F, 0x50, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52, 0x53, 0x53, 0x53, 0x54, 0x54, 0x55, 0x55,
+    0x56, 0x56, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5C, 0x5C,
+    0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63,
+    0x64, 0x64, 0x65, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A,
+    0x6B, 0x6B, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x70, 0x71, 0x71,
+    0x72, 0x72, 0x73, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x77, 0x78, 0x78,
+    0x79, 0x79, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F,
+};
+#endif
 #endif
 
 SignalMeter::SignalMeter()
@@ -32,8 +70,23 @@ SignalMeter::SignalMeter()
     _current_strength = 0;
     _last_decay_time = 0;
     _panel_led_accumulator = 0;
+    _pending_charge = 0;
+    _pending_panel_charge = 0;
     _flashlight_mode = false;
     _flashlight_brightness = 0;
+    for (int i = 0; i < LED_COUNT; i++) {
+        _target_pixels[i] = 0;
+        _shown_pixels[i] = 0;
+    }
+    for (int i = 0; i < 16; i++) {
+        _partial_levels[i] = 0;
+    }
+    _palette_contrast = -1;     // Force palette build on first write
+    _pixels_dirty = false;
+    _last_show_time = 0;
+    _show_count = 0;
+    _shows_per_second = 0;
+    _show_count_time = 0;
 }
 
 void SignalMeter::init()
@@ -41,48 +94,58 @@ void SignalMeter::init()
     clear();
     _panel_led_accumulator = 0;
 #ifndef NATIVE_BUILD
-    // Initialize NeoPixel strip for both platforms
-    if (!_led_strip) {
-        _led_strip = new Adafruit_NeoPixel(LED_COUNT, 12, NEO_GRB + NEO_KHZ800);
-        _led_strip->begin();
-        _led_strip->clear();
-        _led_strip->show();
-    }
+    led_strip->begin();
+    led_strip->clear();
+    led_strip->show();
     _last_decay_time = millis();
+    _show_count_time = _last_decay_time;
 #endif
 }
 
 void SignalMeter::add_charge(int charge_amount)
-{    // Add charge pulse to accumulator (like electrical charge into capacitor)
+{    // Collect charge pulse for this pass (like electrical charge into capacitor)
+    // All stations' pulses are applied together by update()
     if (charge_amount < 0) {
         // Negative charge: treat as panel LED lock pulse
         int abs_charge = -charge_amount;
-        _panel_led_accumulator += abs_charge; // Add absolute value
-        if (_panel_led_accumulator > PANEL_LED_MAX_ACCUMULATOR) {
-            _panel_led_accumulator = PANEL_LED_MAX_ACCUMULATOR;
+        _pending_panel_charge += abs_charge; // Add absolute value
+        if (_pending_panel_charge > PANEL_LED_MAX_ACCUMULATOR) {
+            _pending_panel_charge = PANEL_LED_MAX_ACCUMULATOR;
         }
         charge_amount = abs_charge; // Also update main signal meter as if it was a regular pulse
     }
-    _accumulator += charge_amount;
-    // Clamp to maximum
-    if (_accumulator > MAX_ACCUMULATOR) {
-        _accumulator = MAX_ACCUMULATOR;
+    _pending_charge += charge_amount;
+    if (_pending_charge > MAX_ACCUMULATOR) {
+        _pending_charge = MAX_ACCUMULATOR;
     }
-    // Update display strength based on accumulator
-    _current_strength = (_accumulator * 255) / MAX_ACCUMULATOR;
-    write_leds();
 }
 
 void SignalMeter::update(unsigned long current_time)
 {
+    bool changed = false;
+
+    // Apply the charge collected since the last update
+    if (_pending_charge > 0 || _pending_panel_charge > 0) {
+        _panel_led_accumulator += _pending_panel_charge;
+        if (_panel_led_accumulator > PANEL_LED_MAX_ACCUMULATOR) {
+            _panel_led_accumulator = PANEL_LED_MAX_ACCUMULATOR;
+        }
+        _accumulator += _pending_charge;
+        // Clamp to maximum
+        if (_accumulator > MAX_ACCUMULATOR) {
+            _accumulator = MAX_ACCUMULATOR;
+        }
+        _pending_charge = 0;
+        _pending_panel_charge = 0;
+        changed = true;
+    }
+
     // Apply time-based decay (like capacitor discharging)
     if (current_time - _last_decay_time >= DECAY_INTERVAL) {
         if (_accumulator > 0) {
             _accumulator -= DECAY_RATE;
             if (_accumulator < 0) _accumulator = 0;
-            // Update display strength
-            _current_strength = (_accumulator * 255) / MAX_ACCUMULATOR;
-            write_leds();
+            changed = true;
         }
         // Decay panel LED accumulator
         if (_panel_led_accumulator > 0) {
@@ -91,6 +154,47 @@ void SignalMeter::update(unsigned long current_time)
         }
         _last_decay_time = current_time;
     }
+
+    // Render at most once per update
+    if (changed) {
+        _current_strength = (_accumulator * 255) / MAX_ACCUMULATOR;
+        write_leds();
+    }
+
+    show_leds(current_time);
+}
+
+void SignalMeter::show_leds(unsigned long current_time)
+{
+    // Count show() calls per second for instrumentation
+    if (current_time - _show_count_time >= 1000) {
+        _shows_per_second = _show_count;
+        _show_count = 0;
+        _show_count_time = current_time;
+#if defined(DEBUG_SIGNAL_METER_SHOWS) && !defined(NATIVE_BUILD)
+        Serial.print("SHOWS/S: ");
+        Serial.println(_shows_per_second);
+#endif
+    }
+
+    // Only push visible changes, and no faster than SHOW_INTERVAL
+    if (!_pixels_dirty || current_time - _last_show_time < SHOW_INTERVAL)
+        return;
+
+#ifndef NATIVE_BUILD
+    for (int i = 0; i < LED_COUNT; i++) {
+        led_strip->setPixelColor(i, _target_pixels[i]);
+        _shown_pixels[i] = _target_pixels[i];
+    }
+    led_strip->show();
+#else
+    for (int i = 0; i < LED_COUNT; i++) {
+        _shown_pixels[i] = _target_pixels[i];
+    }
+#endif
+    _pixels_dirty = false;
+    _last_show_time = current_time;
+    _show_count++;
 }
 
 void SignalMeter::update_signal_strength(int strength)
@@ -112,6 +216,8 @@ void SignalMeter::update_signal_strength(int strength)
 
 void SignalMeter::clear()
 {
+    _pending_charge = 0;
+    _pending_panel_charge = 0;
     _accumulator = 0;
     _current_strength = 0;
     _panel_led_accumulator = 0;
@@ -120,6 +226,7 @@ void SignalMeter::clear()
 
 void SignalMeter::clear_panel_led()
 {
+    _pending_panel_charge = 0;
     _panel_led_accumulator = 0;
 }
 
@@ -130,7 +237,7 @@ void SignalMeter::set_flashlight_mode(int brightness)
     if (brightness < 0) _flashlight_brightness = 0;
     if (brightness > 255) _flashlight_brightness = 255;
     
-    // Update LEDs immediately
+    // Update LEDs on the next update()
     write_leds();
 }
 
@@ -139,85 +246,86 @@ void SignalMeter::clear_flashlight_mode()
     _flashlight_mode = false;
     _flashlight_brightness = 0;
     
-    // Update LEDs immediately to return to normal operation
+    // Update LEDs on the next update() to return to normal operation
     write_leds();
 }
 
-void SignalMeter::write_leds()
+void SignalMeter::show_colors(const uint32_t colors[LED_COUNT])
 {
+    for (int i = 0; i < LED_COUNT; i++) {
+#ifndef NATIVE_BUILD
+        led_strip->setPixelColor(i, colors[i]);
+#endif
+        _shown_pixels[i] = colors[i];
+    }
 #ifndef NATIVE_BUILD
+    led_strip->show();
+#endif
+}
+
+void SignalMeter::write_leds()
+{
+    // Compose straight into the target frame, marking dirty only on a visible
+    // change; update() does the actual show()
+    _pixels_dirty = false;
+
     if (_flashlight_mode) {
         // Flashlight mode: set all LEDs to white at specified brightness
         // White is created using RGB mix since these are RGB LEDs, not RGBW
-
-        int white_brightness = _flashlight_brightness;
-        
-        // NeoPixel implementation for both platforms
-        if (_led_strip) {
-            for (int i = 0; i < LED_COUNT; i++) {
-                _led_strip->setPixelColor(i, _led_strip->Color(white_brightness, white_brightness, white_brightness));
-            }
-            _led_strip->show();
+        uint32_t white_brightness = _flashlight_brightness;
+        uint32_t white = (white_brightness << 16) | (white_brightness << 8) | white_brightness;
+        for (int i = 0; i < LED_COUNT; i++) {
+            _pixels_dirty |= (white != _shown_pixels[i]);
+            _target_pixels[i] = white;
         }
     } else {
-        // Normal signal meter mode
-        
-#ifdef ENABLE_LOGARITHMIC_S_METER
-        // Apply square root scaling for S-meter-like behavior
-        // This compresses strong signals while keeping good sensitivity for weak signals
-        // More balanced than pure logarithmic scaling
-        int display_strength;
-        if (_current_strength > 0) {
-            // Square root scaling: sqrt(x) * scale_factor
-            // Provides compression without the extreme behavior of logarithmic
-            float sqrt_value = sqrtf((float)_current_strength);
-            display_strength = (int)(sqrt_value * 16.0f);  // Scale to use 0-255 range
-            if (display_strength > 255) display_strength = 255;
-        } else {
-            display_strength = 0;
+        // Normal signal meter mode: one table lookup, then copy palette colors
+        int on_leds = 0;
+        uint32_t partial = 0;
+
+#ifndef NATIVE_BUILD
+        if (_palette_contrast != option_contrast) {
+            build_palette();
+        }
+
+        int strength = _current_strength;
+        if (strength < 0) strength = 0;
+        if (strength > 255) strength = 255;
+        uint8_t pattern = pgm_read_byte(&STRENGTH_TO_LEDS[strength]);
+        on_leds = pattern >> 4;
+        int remain = pattern & 0x0F;
+
+        // Apply partial brightness to last LED
+        if (on_leds > 0) {
+            partial = LED_CHANNELS_NEOPIXEL[on_leds - 1] * _partial_levels[remain];
         }
-#else
-        // Linear scaling (original behavior)
-        int display_strength = _current_strength;
 #endif
-        
-        // Convert strength to LED display
-        int sample = display_strength * 2;  // Scale to 0-510
-        int on_leds = (sample / 73) + 1;     // How many full LEDs to light
-        int remain = ((sample % 73) * 16) / 73;  // Brightness of partial LED
-        
-        // Ensure we don't exceed LED count
-        if (on_leds > LED_COUNT) on_leds = LED_COUNT;
-        if (on_leds < 0) on_leds = 0;
-        
-        // NeoPixel implementation for both platforms
-        if (_led_strip) {
-            // Clear all pixels first
-            _led_strip->clear();
-            
-            // Set lit LEDs with appropriate colors and brightness
-            for (int i = 0; i < on_leds; i++) {
-                uint32_t color = LED_COLORS_NEOPIXEL[i];
-                uint8_t r = (color >> 16) & 0xFF;
-                uint8_t g = (color >> 8) & 0xFF;
-                uint8_t b = color & 0xFF;
-                
-                // Apply partial brightness to last LED
-                if (i == on_leds - 1) {
-                    r = (r * remain) / 16;
-                    g = (g * remain) / 16;
-                    b = (b * remain) / 16;
-                }
-                
-                // Apply contrast adjustment
-                r = (r * option_contrast) / SIGNAL_METER_BRIGHTNESS_DIVISOR;
-                g = (g * option_contrast) / SIGNAL_METER_BRIGHTNESS_DIVISOR;
-                b = (b * option_contrast) / SIGNAL_METER_BRIGHTNESS_DIVISOR;
-                
-                _led_strip->setPixelColor(i, _led_strip->Color(r, g, b));
+
+        for (int i = 0; i < LED_COUNT; i++) {
+            uint32_t color = 0;
+            if (i < on_leds - 1) {
+                color = _full_colors[i];
+            } else if (i == on_leds - 1) {
+                color = partial;
             }
-            _led_strip->show();
+            _pixels_dirty |= (color != _shown_pixels[i]);
+            _target_pixels[i] = color;
         }
     }
+}
+
+void SignalMeter::build_palette()
+{
+#ifndef NATIVE_BUILD
+    // Same rounding as scaling each pixel at run time: partial brightness first, then contrast
+    for (int remain = 0; remain < 16; remain++) {
+        int level = (LED_FULL_LEVEL * remain) / 16;
+        _partial_levels[remain] = (level * option_contrast) / SIGNAL_METER_BRIGHTNESS_DIVISOR;
+    }
+    uint8_t full_level = (LED_FULL_LEVEL * option_contrast) / SIGNAL_METER_BRIGHTNESS_DIVISOR;
+    for (int i = 0; i < LED_COUNT; i++) {
+        _full_colors[i] = LED_CHANNELS_NEOPIXEL[i] * full_level;
+    }
+    _palette_contrast = option_contrast;
 #endif
 }
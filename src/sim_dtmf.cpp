@@ -59,9 +59,11 @@ const int SimDTMF::DIGIT_TO_COL[16] = {
 SimDTMF::SimDTMF(WaveGenPool *wave_gen_pool, SignalMeter *signal_meter, float fixed_freq)
     : SimDualTone(wave_gen_pool, fixed_freq) , _signal_meter(signal_meter) //, _telco_type(type)
 {
+    _dtmf.set_random(&_random);
+
     // Initialize operator frustration drift tracking
     _cycles_completed = 0;
-    _cycles_until_qsy = 3 + (random(8));   // 3-8 cycles before frustration (realistic)
+    _cycles_until_qsy = 3 + (_random.below(8));   // 3-8 cycles before frustration (realistic)
 
     // Initialize timing state
     _in_wait_delay = false;
@@ -74,6 +76,15 @@ SimDTMF::SimDTMF(WaveGenPool *wave_gen_pool, SignalMeter *signal_meter, float fi
     _digit_sequence = _generated_number;  // Point to generated number
 }
 
+void SimDTMF::seed_random(byte stream){
+    SimDualTone::seed_random(stream);
+    // The constructor ran before the boot seed was known
+    _cycles_until_qsy = 3 + _random.below(8);
+    if (_use_random_numbers) {
+        generate_random_nanp_number();
+    }
+}
+
 bool SimDTMF::begin(unsigned long time){
     // Attempt to acquire all required realizers atomically
     // The new Realization::begin() handles dual generator coordination automatically
@@ -203,7 +214,7 @@ bool SimDTMF::step(unsigned long time){
                 randomize_station();
                 // Reset frustration counter for next QSY
                 _cycles_completed = 0;
-                _cycles_until_qsy = 3 + (random(8));   // 3-8 cycles before next frustration
+                _cycles_until_qsy = 3 + (_random.below(8));   // 3-8 cycles before next frustration
             }
 
             // End of sequence - properly release wave generators using end()
@@ -220,7 +231,7 @@ bool SimDTMF::step(unsigned long time){
         } else {
             // WaveGen not available - extend wait period and try again later
             // Add randomization to prevent thundering herd problem
-            _next_cycle_time = time + 500 + random(1000);     // Try again in 0.5-1.5 seconds
+            _next_cycle_time = time + 500 + _random.below(1000);     // Try again in 0.5-1.5 seconds
         }
     }
 
@@ -265,73 +276,87 @@ int SimDTMF::char_to_digit_index(char c) {
     }
 }
 
+// Area codes for generated numbers, 10 bits each, four codes packed into five bytes
+// (least significant bit first). The last group is padded with an unused zero.
+#define PACK_AREA_CODES(a, b, c, d) \
+    (uint8_t)(a), (uint8_t)(((a) >> 8) | ((b) << 2)), (uint8_t)(((b) >> 6) | ((c) << 4)), \
+    (uint8_t)(((c) >> 4) | ((d) << 6)), (uint8_t)((d) >> 2)
+
+static const uint8_t AREA_CODES[] PROGMEM = {
+    PACK_AREA_CODES(212, 213, 214, 215), PACK_AREA_CODES(216, 217, 301, 302), PACK_AREA_CODES(303, 304, 305, 307),
+    PACK_AREA_CODES(309, 312, 313, 314), PACK_AREA_CODES(315, 316, 317, 318), PACK_AREA_CODES(319, 401, 402, 403),
+    PACK_AREA_CODES(404, 405, 406, 407), PACK_AREA_CODES(408, 409, 410, 412), PACK_AREA_CODES(413, 414, 415, 416),
+    PACK_AREA_CODES(417, 418, 419, 501), PACK_AREA_CODES(502, 503, 504, 505), PACK_AREA_CODES(507, 508, 509, 510),
+    PACK_AREA_CODES(512, 513, 514, 515), PACK_AREA_CODES(516, 517, 518, 519), PACK_AREA_CODES(601, 602, 603, 604),
+    PACK_AREA_CODES(605, 606, 607, 608), PACK_AREA_CODES(609, 610, 612, 613), PACK_AREA_CODES(614, 615, 616, 617),
+    PACK_AREA_CODES(618, 619, 701, 702), PACK_AREA_CODES(703, 704, 705, 706), PACK_AREA_CODES(707, 708, 709, 712),
+    PACK_AREA_CODES(713, 714, 715, 716), PACK_AREA_CODES(717, 718, 719, 801), PACK_AREA_CODES(802, 803, 804, 805),
+    PACK_AREA_CODES(806, 807, 808, 809), PACK_AREA_CODES(810, 812, 813, 814), PACK_AREA_CODES(815, 816, 817, 818),
+    PACK_AREA_CODES(819, 901, 902, 903), PACK_AREA_CODES(904, 905, 906, 907), PACK_AREA_CODES(908, 909, 910, 912),
+    PACK_AREA_CODES(913, 914, 915, 916), PACK_AREA_CODES(917, 918, 919, 0),
+};
+#define AREA_CODE_COUNT 127
+
+static_assert(sizeof(AREA_CODES) == (AREA_CODE_COUNT + 3) / 4 * 5, "AREA_CODES does not hold AREA_CODE_COUNT codes");
+
+// Numbers never generated, in ascending order
+// Prefixes: 555 is reserved for fiction, the others are service codes
+static const uint16_t RESERVED_PREFIXES[] PROGMEM = {411, 555, 611, 911};
+// Suffixes: repeated digits and 1234 look fake
+static const uint16_t RESERVED_SUFFIXES[] PROGMEM = {0, 1111, 1234, 2222, 3333, 4444, 5555, 6666, 7777, 8888, 9999};
+
+static uint16_t area_code_at(byte index)
+{
+    uint16_t bit = index * 10;
+    const uint8_t *p = AREA_CODES + (bit >> 3);
+    uint16_t bits = pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+    return (bits >> (bit & 7)) & 0x3FF;
+}
+
+// Steps value past each of the count sorted reserved values at or below it. Drawn
+// uniformly from a range count values short, the result is uniform over the range
+// without the reserved values, with no second draw.
+static uint16_t skip_reserved(uint16_t value, const uint16_t *reserved, byte count)
+{
+    for (byte i = 0; i < count; i++) {
+        if (value >= pgm_read_word(&reserved[i]))
+            value++;
+    }
+    return value;
+}
+
+// Writes value as count decimal digits, most significant first
+static void emit_digits(char *out, uint16_t value, byte count)
+{
+    while (count--) {
+        out[count] = '0' + value % 10;
+        value /= 10;
+    }
+}
+
 void SimDTMF::generate_random_nanp_number() {
     // Generate authentic North American Numbering Plan (NANP) phone number
     // Format: 1 + NXX + NXX + XXXX (11 digits total)
     // Where N = 2-9, X = 0-9
-    
+    // One draw per field and no formatting: this runs on every QSY
+
     // Country code (always 1 for NANP)
-    char country_code = '1';
-    
-    // Area code: NXX format (first digit 2-9, others 0-9)
-    // Use realistic area codes with geographic diversity
-    int realistic_area_codes[] = {
-        212, 213, 214, 215, 216, 217, 301, 302, 303, 304, 305, 307, 309,
-        312, 313, 314, 315, 316, 317, 318, 319, 401, 402, 403, 404, 405,
-        406, 407, 408, 409, 410, 412, 413, 414, 415, 416, 417, 418, 419,
-        501, 502, 503, 504, 505, 507, 508, 509, 510, 512, 513, 514, 515,
-        516, 517, 518, 519, 601, 602, 603, 604, 605, 606, 607, 608, 609,
-        610, 612, 613, 614, 615, 616, 617, 618, 619, 701, 702, 703, 704,
-        705, 706, 707, 708, 709, 712, 713, 714, 715, 716, 717, 718, 719,
-        801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 812, 813, 814,
-        815, 816, 817, 818, 819, 901, 902, 903, 904, 905, 906, 907, 908,
-        909, 910, 912, 913, 914, 915, 916, 917, 918, 919
-    };
-    
-    int area_code = realistic_area_codes[random(sizeof(realistic_area_codes) / sizeof(realistic_area_codes[0]))];
-    
-    // Central office code (prefix): NXX format (first digit 2-9, others 0-9)
-    // Avoid 555 prefix (traditionally reserved for fiction) and special codes
-    int prefix_first = 2 + random(8);  // 2-9
-    int prefix_second, prefix_third;
-    
-    do {
-        prefix_second = random(10);    // 0-9  
-        prefix_third = random(10);     // 0-9
-        
-        int prefix = prefix_first * 100 + prefix_second * 10 + prefix_third;
-        if (prefix == 555 || prefix == 911 || prefix == 411 || prefix == 611) {
-            continue;  // Avoid reserved prefixes
-        }
-        break;
-    } while (true);
-    
-    // Subscriber number (suffix): XXXX format (all digits 0-9)
-    // Avoid patterns like 0000, 1111, 1234 for more realism
-    int suffix_1, suffix_2, suffix_3, suffix_4;
-    
-    do {
-        suffix_1 = random(10);
-        suffix_2 = random(10);
-        suffix_3 = random(10);
-        suffix_4 = random(10);
-        
-        // Check for obviously fake patterns
-        if (suffix_1 == suffix_2 && suffix_2 == suffix_3 && suffix_3 == suffix_4) {
-            continue;  // Avoid 0000, 1111, etc.
-        }
-        if (suffix_1 == 1 && suffix_2 == 2 && suffix_3 == 3 && suffix_4 == 4) {
-            continue;  // Avoid 1234
-        }
-        break;
-    } while (true);
-    
-    // Format as complete 11-digit NANP number: 1NXXNXXXXXX
-    snprintf(_generated_number, sizeof(_generated_number), "%c%03d%d%d%d%d%d%d%d",
-             country_code,
-             area_code,
-             prefix_first, prefix_second, prefix_third,
-             suffix_1, suffix_2, suffix_3, suffix_4);
+    _generated_number[0] = '1';
+
+    // Area code: realistic codes with geographic diversity
+    emit_digits(_generated_number + 1, area_code_at(_random.below(AREA_CODE_COUNT)), 3);
+
+    // Central office code (prefix): NXX, 200-999 without the reserved prefixes
+    const byte prefix_count = sizeof(RESERVED_PREFIXES) / sizeof(RESERVED_PREFIXES[0]);
+    uint16_t prefix = skip_reserved(200 + _random.below(800 - prefix_count), RESERVED_PREFIXES, prefix_count);
+    emit_digits(_generated_number + 4, prefix, 3);
+
+    // Subscriber number (suffix): XXXX without the fake-looking patterns
+    const byte suffix_count = sizeof(RESERVED_SUFFIXES) / sizeof(RESERVED_SUFFIXES[0]);
+    uint16_t suffix = skip_reserved(_random.below(10000 - suffix_count), RESERVED_SUFFIXES, suffix_count);
+    emit_digits(_generated_number + 7, suffix, 4);
+
+    _generated_number[11] = '\0';
 }
 
 // // Set station into retry state (used when initialization fails)
@@ -354,7 +379,7 @@ void SimDTMF::randomize_station()
         const float DRIFT_RANGE = 250.0f;
         const float VFO_STEP = 100.0f;  // Match VFO_TUNING_STEP_SIZE from StationManager
 
-        float drift = ((float)random(0, (long)(2.0f * DRIFT_RANGE * 100))) / 100.0f - DRIFT_RANGE;
+        float drift = ((float)_random.below_long((uint32_t)(2.0f * DRIFT_RANGE * 100))) / 100.0f - DRIFT_RANGE;
 
         // Apply drift to the shared frequency
         float new_freq = _fixed_freq + drift;
@@ -379,7 +404,7 @@ void SimDTMF::randomize_station()
 
     // REALISM: Add 3-5 second delay before operator starts transmitting again
     // This simulates the time needed for retuning and getting back on the air
-    unsigned long restart_delay = 3000 + random(2000);  // 3-5 seconds
+    unsigned long restart_delay = 3000 + _random.below(2000);  // 3-5 seconds
     _in_wait_delay = true;
     _next_cycle_time = millis() + restart_delay;
     
@@ -407,7 +432,7 @@ void SimDTMF::randomize()
     _cycles_completed = 0;
     
     // Set a new random frustration threshold (cycles until QSY)
-    _cycles_until_qsy = random(3, 11);  // 3-10 cycles before getting frustrated
+    _cycles_until_qsy = 3 + _random.below(8);  // 3-10 cycles before getting frustrated
     
     // Reset timing state
     _in_wait_delay = false;
@@ -440,12 +465,3 @@ void SimDTMF::randomize()
 //             break;
 //     }
 // }
-
-// Override frequency offset methods to use stored values instead of macros
-float SimDTMF::getFrequencyOffsetA() const {
-    return _frequency_offset_a;
-}
-
-float SimDTMF::getFrequencyOffsetC() const {
-    return _frequency_offset_c;
-}
@@ -2,6 +2,7 @@
 #include "wavegen.h"
 #include "vfo.h"
 #include "saved_data.h"
+#include "telemetry.h"
 
 SimDualTone::SimDualTone(WaveGenPool *wave_gen_pool, float fixed_freq) 
     : Realization(wave_gen_pool, (int)(fixed_freq / 1000), 
@@ -18,9 +19,17 @@ SimDualTone::SimDualTone(WaveGenPool *wave_gen_pool, float fixed_freq)
     _raw_frequency = 0.0;
     _frequency = 0.0;
     _frequency2 = 0.0;
+
+    // Default offsets - derived classes replace these for their signal type
+    _frequency_offset_a = GENERATOR_A_TEST_OFFSET;
+    _frequency_offset_c = GENERATOR_C_TEST_OFFSET;
     
     // Initialize dynamic station management state
     _station_state = DORMANT;
+
+    // Placeholder until seed_random() applies the boot seed; the subclasses draw
+    // again there whatever their constructors took from it
+    _random.seed(fast_random.next());
 }
 
 bool SimDualTone::common_begin(unsigned long time, float fixed_freq)
@@ -28,9 +37,6 @@ bool SimDualTone::common_begin(unsigned long time, float fixed_freq)
     // Set shared properties first
     _fixed_freq = fixed_freq;
     
-    // Update station ID for debugging (frequency in kHz)
-    set_station_id((int)(fixed_freq / 1000));
-    
     // Attempt to acquire all required realizers atomically
     bool success = Realization::begin(time);
     if(!success) {
@@ -57,6 +63,12 @@ void SimDualTone::common_frequency_update(Mode *mode)
     // This shifts the audio frequency without affecting signal meter calculations
     _frequency = _raw_frequency + option_bfo_offset + getFrequencyOffsetA();
     _frequency2 = _raw_frequency + option_bfo_offset + getFrequencyOffsetC();
+
+    // Re-evaluate the bounds before the caller pushes: a station coming back into range
+    // (or starting while _vfo_freq was still unset) is only re-enabled here, and would
+    // otherwise keep its generators on SILENT_FREQ until the next tuning step
+    if(has_all_realizers())
+        check_frequency_bounds();
 }
 
 bool SimDualTone::check_frequency_bounds()
@@ -153,6 +165,9 @@ void SimDualTone::set_station_state(StationState new_state)
     StationState old_state = _station_state;
     _station_state = new_state;
     
+    if(new_state != old_state)
+        TELEMETRY(TELEMETRY_STATE, _station_id, new_state);
+    
     // Handle state transition logic
     if(old_state == AUDIBLE && new_state != AUDIBLE) {
         // Losing AD9833 generator - release it
@@ -185,6 +200,11 @@ bool SimDualTone::isActive() const {
     return _active;  // Use shared variable
 }
 
+void SimDualTone::seed_random(byte stream)
+{
+    _random.seed(fast_random_stream_seed(stream));
+}
+
 void SimDualTone::force_frequency_update()
 {
     // Immediately recalculate frequencies and update wave generators
@@ -229,10 +249,12 @@ void SimDualTone::force_frequency_update()
 // Centralized charge pulse logic for all simulated stations
 void SimDualTone::send_carrier_charge_pulse(SignalMeter* signal_meter) {
     if (!signal_meter) return;
-    int charge = VFO::calculate_signal_charge(_fixed_freq, _vfo_freq);
+    long station_freq = (long)_fixed_freq;
+    long vfo_freq = (long)_vfo_freq;
+    int charge = VFO::calculate_signal_charge(station_freq, vfo_freq);
     if (charge > 0) {
-        const float LOCK_WINDOW_HZ = 50.0; // Lock window threshold (adjust as needed)
-        float freq_diff = abs(_fixed_freq - _vfo_freq);
+        const long LOCK_WINDOW_HZ = 50; // Lock window threshold (adjust as needed)
+        long freq_diff = labs(station_freq - vfo_freq);
         if (freq_diff <= LOCK_WINDOW_HZ) {
             signal_meter->add_charge(-charge);
         } else {
@@ -240,12 +262,3 @@ void SimDualTone::send_carrier_charge_pulse(SignalMeter* signal_meter) {
         }
     }
 }
-
-// Virtual methods for frequency offsets (default implementation uses macros)
-float SimDualTone::getFrequencyOffsetA() const {
-    return GENERATOR_A_TEST_OFFSET;  // Default to macro for backward compatibility
-}
-
-float SimDualTone::getFrequencyOffsetC() const {
-    return GENERATOR_C_TEST_OFFSET;  // Default to macro for backward compatibility
-}
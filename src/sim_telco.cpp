@@ -43,12 +43,12 @@ const float SimTelco::RING_FREQ_A = SimTelco::RINGBACK_FREQ_A;
 const float SimTelco::RING_FREQ_C = SimTelco::RINGBACK_FREQ_C;
 
 // Helper function to calculate drift cycles based on TelcoType
-int calculateDriftCycles(TelcoType type) {
+int calculateDriftCycles(TelcoType type, FastRandom &random) {
     int type_index = (int)type;  // Convert enum to array index
     if (type_index >= 0 && type_index < TELCO_TYPES_COUNT) {
-        return DRIFT_MIN_CYCLES[type_index] + random(DRIFT_ADDITIONAL_CYCLES[type_index]);
+        return DRIFT_MIN_CYCLES[type_index] + random.below(DRIFT_ADDITIONAL_CYCLES[type_index]);
     }
-    return DEFAULT_CYCLES + random(DEFAULT_CYCLES);  // Fallback to original behavior
+    return DEFAULT_CYCLES + random.below(DEFAULT_CYCLES);  // Fallback to original behavior
 }
 
 // mode is expected to be a derivative of VFO
@@ -60,16 +60,23 @@ SimTelco::SimTelco(WaveGenPool *wave_gen_pool, SignalMeter *signal_meter, float
     
     // Configure AsyncTelco timing based on telco type
     _telco.configure_timing(type);
+    _telco.set_random(&_random);
     
     // Initialize operator frustration drift tracking
     _cycles_completed = 0;
-    _cycles_until_qsy = calculateDriftCycles(type);  // Per-type drift cycles (realistic telephony behavior)
+    _cycles_until_qsy = calculateDriftCycles(type, _random);  // Per-type drift cycles (realistic telephony behavior)
 
     // Initialize timing state
     _in_wait_delay = false;
     _next_cycle_time = 0;
 }
 
+void SimTelco::seed_random(byte stream){
+    SimDualTone::seed_random(stream);
+    // The constructor ran before the boot seed was known
+    _cycles_until_qsy = calculateDriftCycles(_telco_type, _random);
+}
+
 bool SimTelco::begin(unsigned long time){
     // Attempt to acquire all required realizers atomically
     // The new Realization::begin() handles dual generator coordination automatically
@@ -187,7 +194,7 @@ bool SimTelco::step(unsigned long time){
                 randomize_station();
                 // Reset frustration counter for next QSY
                 _cycles_completed = 0;
-                _cycles_until_qsy = calculateDriftCycles(_telco_type);  // Per-type drift cycles
+                _cycles_until_qsy = calculateDriftCycles(_telco_type, _random);  // Per-type drift cycles
             }
             break;
             
@@ -210,7 +217,7 @@ bool SimTelco::step(unsigned long time){
         } else {
             // WaveGen not available - extend wait period and try again later
             // Add randomization to prevent thundering herd problem
-            _next_cycle_time = time + 500 + random(1000);     // Try again in 0.5-1.5 seconds
+            _next_cycle_time = time + 500 + _random.below(1000);     // Try again in 0.5-1.5 seconds
         }
     }
 
@@ -237,7 +244,7 @@ void SimTelco::randomize_station()
         const float DRIFT_RANGE = 500.0f;
         const float VFO_STEP = 100.0f;  // Match VFO_TUNING_STEP_SIZE from StationManager
 
-        float drift = ((float)random(0, (long)(2.0f * DRIFT_RANGE * 100))) / 100.0f - DRIFT_RANGE;
+        float drift = ((float)_random.below_long((uint32_t)(2.0f * DRIFT_RANGE * 100))) / 100.0f - DRIFT_RANGE;
 
         // Apply drift to the shared frequency
         float new_freq = _fixed_freq + drift;
@@ -249,7 +256,7 @@ void SimTelco::randomize_station()
     // REALISM: Randomly switch to a different TelcoType (different telephone system)
     // This simulates different operators or telephone exchanges coming on the air
     TelcoType new_types[] = {TELCO_RINGBACK, TELCO_BUSY, TELCO_REORDER, TELCO_DIALTONE};
-    _telco_type = new_types[random(4)];  // Randomly pick one of the 4 types
+    _telco_type = new_types[_random.below(4)];  // Randomly pick one of the 4 types
     
     // Update frequency offsets for the new telco type
     setFrequencyOffsetsForType();
@@ -258,7 +265,7 @@ void SimTelco::randomize_station()
     _telco.configure_timing(_telco_type);
     
     // Reset frustration counter with new type-specific cycles
-    _cycles_until_qsy = calculateDriftCycles(_telco_type);
+    _cycles_until_qsy = calculateDriftCycles(_telco_type, _random);
     
     if(!skip_frequency_drift){
         // Immediately update the wave generator frequency
@@ -267,7 +274,7 @@ void SimTelco::randomize_station()
 
     // REALISM: Add 3-5 second delay before operator starts transmitting again
     // This simulates the time needed for retuning and getting back on the air
-    unsigned long restart_delay = 3000 + random(2000);  // 3-5 seconds
+    unsigned long restart_delay = 3000 + _random.below(2000);  // 3-5 seconds
     set_retry_state(millis() + restart_delay);
     
     // Stop current transmission to make the delay effective
@@ -282,7 +289,7 @@ void SimTelco::randomize()
     _cycles_completed = 0;
     
     // Set a new random frustration threshold (cycles until QSY)
-    _cycles_until_qsy = calculateDriftCycles(_telco_type);  // Per-type drift cycles
+    _cycles_until_qsy = calculateDriftCycles(_telco_type, _random);  // Per-type drift cycles
     
     // Reset timing state
     _in_wait_delay = false;
@@ -315,12 +322,3 @@ void SimTelco::setFrequencyOffsetsForType() {
             break;
     }
 }
-
-// Override frequency offset methods to use stored values instead of macros
-float SimTelco::getFrequencyOffsetA() const {
-    return _frequency_offset_a;
-}
-
-float SimTelco::getFrequencyOffsetC() const {
-    return _frequency_offset_c;
-}
@@ -1,5 +1,7 @@
 #include "station_state.h"
 #include "station_manager.h"
+#include "fast_random.h"
+#include "telemetry.h"
 
 // MEMORY OPTIMIZATION: Constructor that shares realizations array to eliminate duplicate arrays
 // REQUIREMENT: All array entries MUST be SimTransmitter-derived objects
@@ -9,6 +11,7 @@ StationManager::StationManager(Realization* shared_stations[], int actual_statio
     // All station classes inherit from both Realization and SimTransmitter
     for (int i = 0; i < actual_station_count; ++i) {
         stations[i] = static_cast<SimDualTone*>(shared_stations[i]);
+        stations[i]->set_station_id(i);  // table index, as reported by telemetry
         stations[i]->setActive(false);
         stations[i]->set_station_state(DORMANT);
     }
@@ -26,6 +29,11 @@ StationManager::StationManager(Realization* shared_stations[], int actual_statio
     pipeline_center_freq = 0;
     tuning_direction = 0;
     last_tuning_time = 0;
+    last_realloc_time = 0;
+    pipeline_params = {PIPELINE_LOOKAHEAD_RANGE, PIPELINE_REALLOC_THRESHOLD, PIPELINE_REALLOC_INTERVAL, PIPELINE_SETTLE_TIME};
+#ifdef ENABLE_PIPELINE_STATS
+    stations_moved_total = 0;
+#endif
 }
 
 void StationManager::updateStations(uint32_t vfo_freq) {
@@ -127,6 +135,7 @@ void StationManager::enableDynamicPipelining(bool enable) {
         last_vfo_freq = 0;
         pipeline_center_freq = 0;
         last_tuning_time = 0;
+        last_realloc_time = 0;
     }
 }
 
@@ -147,18 +156,10 @@ void StationManager::setupPipeline(uint32_t vfo_freq) {
         stations[i]->setActive(true);
         stations[i]->set_station_state(ACTIVE);
         
-        #ifdef DEBUG_PIPELINING
-        Serial.print("SETUP S");
-        Serial.print(i);
-        Serial.print(" at ");
-        Serial.println((uint32_t)stations[i]->get_fixed_frequency());
-        #endif
+        TELEMETRY(TELEMETRY_STATION, i, (uint32_t)stations[i]->get_fixed_frequency());
     }
     
-    #ifdef DEBUG_PIPELINING
-    Serial.print("INIT: ");
-    Serial.println(vfo_freq);
-    #endif
+    TELEMETRY(TELEMETRY_VFO, 0, vfo_freq);
 }
 
 void StationManager::updatePipeline(uint32_t vfo_freq) {
@@ -175,6 +176,9 @@ void StationManager::updatePipeline(uint32_t vfo_freq) {
         int new_direction = (freq_change > 0) ? 1 : -1;
         
         // Update tuning direction - always accept new direction for responsive pipelining
+        if (new_direction != tuning_direction) {
+            TELEMETRY(TELEMETRY_TUNING, new_direction > 0 ? TELEMETRY_TUNING_UP : TELEMETRY_TUNING_DOWN, vfo_freq);
+        }
         tuning_direction = new_direction;
         
         last_tuning_time = current_time;
@@ -182,48 +186,26 @@ void StationManager::updatePipeline(uint32_t vfo_freq) {
         
         // Update pipeline center frequency with hysteresis
         int32_t center_shift = (int32_t)(vfo_freq - pipeline_center_freq);
-        if (abs(center_shift) >= PIPELINE_REALLOC_THRESHOLD) {
+        if (abs(center_shift) >= pipeline_params.realloc_threshold) {
             // Reduce time between reallocations for more responsive pipelining
-            static unsigned long last_realloc_time = 0;
-            if (current_time - last_realloc_time > 200) { // 200ms instead of 500ms
-                #ifdef DEBUG_PIPELINING
-                Serial.print("CALLING reallocateStations, shift=");
-                Serial.println(center_shift);
-                #endif
+            if (current_time - last_realloc_time > pipeline_params.realloc_interval) {
                 reallocateStations(vfo_freq);
                 pipeline_center_freq = vfo_freq;
                 last_realloc_time = current_time;
             }
         }
-        
-        #ifdef DEBUG_PIPELINING
-        Serial.print("PIPE: ");
-        Serial.print(vfo_freq);
-        Serial.print(" dir=");
-        Serial.println(tuning_direction);
-        #endif
     }
-    else if (current_time - last_tuning_time > 5000) { // 5 second settle time - longer to allow listening
+    else if (current_time - last_tuning_time > pipeline_params.settle_time) {
         // User has stopped tuning - pause pipeline updates
         if (tuning_direction != 0) {
             tuning_direction = 0;
-            #ifdef DEBUG_PIPELINING
-            Serial.println("PAUSE");
-            #endif
+            TELEMETRY(TELEMETRY_TUNING, TELEMETRY_TUNING_PAUSED, vfo_freq);
         }
     }
 }
 
 void StationManager::reallocateStations(uint32_t vfo_freq) {
-    #ifdef DEBUG_PIPELINING
-    Serial.print("reallocate called, dir=");
-    Serial.println(tuning_direction);
-    #endif
-    
     if (tuning_direction == 0) {
-        #ifdef DEBUG_PIPELINING
-        Serial.println("SKIP: dir=0");
-        #endif
         return; // Not tuning - don't move stations
     }
     
@@ -243,18 +225,7 @@ void StationManager::reallocateStations(uint32_t vfo_freq) {
         int32_t distance_from_vfo = (int32_t)(station_freq - vfo_freq);
         uint32_t abs_distance = abs(distance_from_vfo);
         
-        #ifdef DEBUG_PIPELINING
-        Serial.print("S");
-        Serial.print(i);
-        Serial.print(": ");
-        Serial.print(station_freq);
-        Serial.print(" dist=");
-        Serial.print(abs_distance);
-        Serial.print(" vs ");
-        Serial.println(PIPELINE_LOOKAHEAD_RANGE);
-        #endif
-        
-        if (abs_distance > PIPELINE_LOOKAHEAD_RANGE) {
+        if (abs_distance > pipeline_params.lookahead_range) {
             StationState state = stations[i]->get_station_state();
             
             // Determine if station can be safely interrupted
@@ -270,17 +241,6 @@ void StationManager::reallocateStations(uint32_t vfo_freq) {
                 can_interrupt = (abs_distance > PIPELINE_AUDIBLE_RANGE);
             }
             
-            #ifdef DEBUG_PIPELINING
-            Serial.print("  state=");
-            Serial.print(state);
-            Serial.print(" abs_dist=");
-            Serial.print(abs_distance);
-            Serial.print(" range=");
-            Serial.print(PIPELINE_AUDIBLE_RANGE);
-            Serial.print(" can_int=");
-            Serial.println(can_interrupt);
-            #endif
-            
             if (can_interrupt) {
                 candidates[candidate_count] = {i, abs_distance, can_interrupt};
                 candidate_count++;
@@ -288,11 +248,7 @@ void StationManager::reallocateStations(uint32_t vfo_freq) {
         }
     }
     
-    #ifdef DEBUG_PIPELINING
-    Serial.print("Found ");
-    Serial.print(candidate_count);
-    Serial.println(" candidates");
-    #endif
+    TELEMETRY(TELEMETRY_REALLOC, candidate_count, vfo_freq);
     
     // Sort candidates by distance (furthest first)
     for (int i = 0; i < candidate_count - 1; ++i) {
@@ -309,7 +265,7 @@ void StationManager::reallocateStations(uint32_t vfo_freq) {
     // Shuffle the candidates array to randomize selection order among stations at similar distances
     if (candidate_count > 0) {
         for (int i = candidate_count - 1; i > 0; --i) {
-            int j = random(i + 1);  // Random index from 0 to i
+            int j = fast_random.below(i + 1);  // Random index from 0 to i
             if (i != j) {
                 StationDistance temp = candidates[i];
                 candidates[i] = candidates[j];
@@ -360,16 +316,11 @@ void StationManager::reallocateStations(uint32_t vfo_freq) {
         stations[i]->randomize();
         
         stations_moved++;
-        
-        #ifdef DEBUG_PIPELINING
-        Serial.print("MOVE: S");
-        Serial.print(i);
-        Serial.print(" to ");
-        Serial.print(new_freq);
-        Serial.print(" (aligned to ");
-        Serial.print(VFO_TUNING_STEP_SIZE);
-        Serial.println("Hz steps)");
+        #ifdef ENABLE_PIPELINE_STATS
+        stations_moved_total++;
         #endif
+        
+        TELEMETRY(TELEMETRY_MOVE, i, new_freq);
     }
 }
 
@@ -396,13 +347,13 @@ void StationManager::updateStationStates(uint32_t vfo_freq) {
             
             if (tuning_direction > 0) {
                 // Tuning up - use standard range for stations above VFO, smaller for below
-                effective_lookahead_range = (signed_freq_diff > 0) ? PIPELINE_LOOKAHEAD_RANGE : PIPELINE_LOOKAHEAD_RANGE / 2;
+                effective_lookahead_range = (signed_freq_diff > 0) ? pipeline_params.lookahead_range : pipeline_params.lookahead_range / 2;
             } else if (tuning_direction < 0) {
                 // Tuning down - use larger range for stations below VFO, smaller for above
-                effective_lookahead_range = (signed_freq_diff < 0) ? 8000 : PIPELINE_LOOKAHEAD_RANGE / 2; // 8kHz for stations below when tuning down
+                effective_lookahead_range = (signed_freq_diff < 0) ? pipeline_params.lookahead_range : pipeline_params.lookahead_range / 2; // full range for stations below when tuning down
             } else {
                 // Not tuning - use symmetric range
-                effective_lookahead_range = PIPELINE_LOOKAHEAD_RANGE;
+                effective_lookahead_range = pipeline_params.lookahead_range;
             }
             
             if (abs_freq_diff > effective_lookahead_range) {
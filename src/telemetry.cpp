@@ -0,0 +1,70 @@
+#include "telemetry.h"
+#include "input_trace.h"
+
+#ifdef ENABLE_TELEMETRY
+
+#ifdef ENABLE_INPUT_TRACE
+#error "ENABLE_TELEMETRY and ENABLE_INPUT_TRACE are both binary Serial streams"
+#endif
+
+#define TELEMETRY_RING_MASK (TELEMETRY_RING_SIZE - 1)
+
+Telemetry telemetry;
+
+void Telemetry::begin(){
+    _head = 0;
+    _tail = 0;
+    _lost = 0;
+    _started = true;
+    record(TELEMETRY_BOOT, 0, TELEMETRY_VERSION);
+}
+
+void Telemetry::record(byte id, byte arg, unsigned long value){
+    if(!_started)
+        return;
+
+    byte free = (byte)(_tail - _head - 1) & TELEMETRY_RING_MASK;
+    if(free < TELEMETRY_RECORD_SIZE * (_lost ? 2 : 1)){
+        // make room in the Serial TX buffer before giving up
+        send();
+        free = (byte)(_tail - _head - 1) & TELEMETRY_RING_MASK;
+        if(free < TELEMETRY_RECORD_SIZE * (_lost ? 2 : 1)){
+            _lost++;
+            return;
+        }
+    }
+
+    if(_lost){
+        unsigned long lost = _lost;
+        _lost = 0;
+        record(TELEMETRY_LOST, 0, lost);
+    }
+
+    unsigned long time = millis();
+    byte bytes[TELEMETRY_RECORD_SIZE];
+    bytes[0] = 0x80 | id;
+    bytes[1] = arg & 0x7F;
+    for(byte i = 0; i < 4; i++){
+        bytes[2 + i] = time & 0x7F;
+        time >>= 7;
+    }
+    for(byte i = 0; i < 5; i++){
+        bytes[6 + i] = value & 0x7F;
+        value >>= 7;
+    }
+
+    for(byte i = 0; i < TELEMETRY_RECORD_SIZE; i++){
+        _ring[_head] = bytes[i];
+        _head = (_head + 1) & TELEMETRY_RING_MASK;
+    }
+}
+
+void Telemetry::send(){
+    int room = Serial.availableForWrite();
+    while(room-- > 0 && _tail != _head){
+        Serial.write(_ring[_tail]);
+        _tail = (_tail + 1) & TELEMETRY_RING_MASK;
+    }
+}
+
+#endif // ENABLE_TELEMETRY
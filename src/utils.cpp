@@ -2,6 +2,7 @@
 #include "../include/buffers.h"
 #include "../include/saved_data.h"
 #include "../include/utils.h"
+#include "../include/fast_random.h"
 
 char * load_f_string(const __FlashStringHelper* f_string, char *override_buffer){
 	const char *p = (const char PROGMEM *)f_string;
@@ -12,7 +13,7 @@ void random_unique(int count, int max_value, int *result){
     for(int i = 0; i < count; i++){
         bool found = false;
         while(!found){
-            result[i] = random(max_value);
+            result[i] = fast_random.below(max_value);
             found = true;
             for(int j = 0; j < i; j++){
                 if(result[i] == result[j]){
@@ -23,3 +24,34 @@ void random_unique(int count, int max_value, int *result){
         }
     }
 }
+
+// 16-bit division only, so each digit is a fast divide on AVR
+char * format_uint(char *buffer, unsigned int value, byte width, char pad){
+	if(width == 0){
+		unsigned int remaining = value;
+		do {
+			width++;
+			remaining /= 10;
+		} while(remaining);
+	}
+
+	char *p = buffer + width;
+	do {
+		*--p = '0' + (value % 10);
+		value /= 10;
+	} while(value && p > buffer);
+	while(p > buffer)
+		*--p = pad;
+	return buffer + width;
+}
+
+// splits off the low four digits with one 32-bit divide, the rest is 16-bit
+char * format_ulong(char *buffer, unsigned long value, byte width, char pad){
+	if(value < 10000UL)
+		return format_uint(buffer, (unsigned int)value, width, pad);
+
+	unsigned long high = value / 10000UL;
+	unsigned int low = (unsigned int)(value - (high * 10000UL));
+	char *p = format_ulong(buffer, high, width > 4 ? width - 4 : 0, pad);
+	return format_uint(p, low, 4, '0');
+}
@@ -4,9 +4,11 @@
 #include "buffers.h"
 #include "signal_meter.h"
 #include "station_config.h"
+#include "static_realization_pool.h"
 #include "saved_data.h"
+#include "utils.h"
 
-VFO::VFO(const char *title, long frequency, unsigned long step, RealizationPool *realization_pool) : Mode(title)
+VFO::VFO(const char *title, long frequency, unsigned long step, StationRealizationPool *realization_pool) : Mode(title)
 {
     _frequency = frequency;
     _sub_frequency = int((frequency - _frequency) * 10.0);
@@ -17,35 +19,34 @@ VFO::VFO(const char *title, long frequency, unsigned long step, RealizationPool
 // step needs to be in 0.1Hz units
 // when step is 0.1Hz, use xxxxxxx.y format
 void VFO::update_display(HT16K33Disp *display){
+    // Digits are formatted directly (no sprintf); the display framebuffer only
+    // resends digits whose segments changed
+    char *p = display_text_buffer;
     if(_frequency >= 1000000000L){
-        // Display as 2450.0000 in MHz
-        int megpart = _frequency / 1000000L;
+        // Display as 2450.0000 in MHz ("%4d.%04d")
+        unsigned int megpart = _frequency / 1000000L;
+        unsigned long decpart = _frequency - (megpart * 1000000L);
+        unsigned int decparti = decpart / 100L;
 
-        long decpart = _frequency - (megpart * 1000000L);
-        
-        int decparti = decpart / 100L;
-        
-        sprintf(display_text_buffer, "%4d.%04d", megpart, decparti);
+        p = format_uint(p, megpart, 4, ' ');
+        *p++ = '.';
+        p = format_uint(p, decparti, 4, '0');
         
     } else if(_frequency >= 100000000L) {
-        // Display 7,015,089 as 7015.089 in KHz
-        // int megpart = _frequency / 1000000L;
-        // long remainder = _frequency - (megpart * 1000000L);
-        
-        // int kilpart = remainder / 1000L;
-        // remainder = remainder - (kilpart * 1000L);
-        
-        // int unipart = remainder;
-        
-        // sprintf(display_text_buffer, "%2d.%03d.%03d", megpart, kilpart, unipart);
-        long prepart = _frequency / 1000000L;
-        long remainder = _frequency - (prepart * 1000000L);
-        long sufpart = remainder / 100L;
-        sprintf(display_text_buffer, "%3ld-%04ld", prepart, sufpart);
+        // Display 555,123,400 as 555-1234 exchange number ("%3ld-%04ld")
+        unsigned int prepart = _frequency / 1000000L;
+        unsigned long remainder = _frequency - (prepart * 1000000L);
+        unsigned int sufpart = remainder / 100L;
+
+        p = format_uint(p, prepart, 3, ' ');
+        *p++ = '-';
+        p = format_uint(p, sufpart, 4, '0');
         
     } else {
-        // Display in Hz
-        sprintf(display_text_buffer, "%8ld", _frequency);    }
+        // Display in Hz ("%8ld")
+        p = format_ulong(p, _frequency, 8, ' ');
+    }
+    *p = 0;
 
     display->show_string(display_text_buffer);
 }
@@ -73,32 +74,32 @@ void VFO::update_signal_meter(SignalMeter *signal_meter) {
 }
 
 // Static utility for stations to calculate signal strength charge based on VFO proximity
-int VFO::calculate_signal_charge(float station_freq, float vfo_freq) {
+// Proximity table: charge for a station whose offset into the receiver passband
+// (VFO minus station, BFO corrected) is between 0 and max_offset Hz.
+// Integer form of the previous float curve: (int)((1 - offset/5000)^2 * 2)
+struct SignalChargeStep {
+    long max_offset;
+    int charge;
+};
+
+static const SignalChargeStep SIGNAL_CHARGE_TABLE[] = {
+    {    0, 2 },    // Zero beat
+    { 1464, 1 },    // (1 - offset/5000)^2 >= 0.5
+};                  // Beyond that the curve truncates to 0 up to MAX_AUDIBLE_FREQ
+
+int VFO::calculate_signal_charge(long station_freq, long vfo_freq) {
     // Calculate frequency difference using same method as audio system
     // Apply BFO offset so meter responds to full receiver passband, not just positive audio
-    float freq_diff = vfo_freq - (station_freq - option_bfo_offset);
-    
-    // Signal strength calculation:
-    // - Charge starts when station enters receiver passband (at BFO offset below station)
-    // - Range 0 to +5000 Hz matching audio system behavior
-    // - Perfect consistency: signal meter matches receiver passband
-    
-    const float MAX_RANGE = 5000.0;  // Match MAX_AUDIBLE_FREQ for perfect consistency
-    
-    // Respond to receiver passband: BFO offset below station frequency to +5000 Hz above
-    if (freq_diff >= 0 && freq_diff <= MAX_RANGE) {
-        // Calculate proximity factor (0.0 to 1.0)
-        float proximity = 1.0 - (freq_diff / MAX_RANGE);
-        
-        // Apply squared curve for realistic but not too steep falloff
-        proximity = proximity * proximity;
-        
-        // Convert proximity to charge amount (much reduced for proportionality)
-        // Lower charge amounts prevent meter from jumping too high
-        int charge = (int)(proximity * 2.0);  // 0-2 charge amount (much reduced)
-        
-        return charge;
+    long freq_diff = vfo_freq - (station_freq - option_bfo_offset);
+
+    // Charge starts when station enters receiver passband (at BFO offset below station)
+    if (freq_diff < 0)
+        return 0;
+
+    for (unsigned int i = 0; i < sizeof(SIGNAL_CHARGE_TABLE) / sizeof(SIGNAL_CHARGE_TABLE[0]); i++) {
+        if (freq_diff <= SIGNAL_CHARGE_TABLE[i].max_offset)
+            return SIGNAL_CHARGE_TABLE[i].charge;
     }
-    
+
     return 0;  // No charge if out of receiver passband
 }
@@ -3,6 +3,31 @@
 
 VFO_Tuner::VFO_Tuner(Mode * mode) : ModeHandler(mode)
 {
+    _last_detent_time = 0;
+    _last_direction = 0;
+    _quick_detents = 0;
+}
+
+// step size for this detent based on how quickly the detents are arriving
+unsigned long VFO_Tuner::tuning_step(int direction, unsigned int detent_time){
+    VFO *vfo = (VFO*) _mode;
+
+    // 16-bit wraparound arithmetic is fine for intervals up to ~65 seconds
+    unsigned int interval = detent_time - _last_detent_time;
+    _last_detent_time = detent_time;
+
+    if(direction != _last_direction || interval > TUNING_ACCEL_MEDIUM_INTERVAL){
+        _quick_detents = 0;
+    } else if(_quick_detents < 255){
+        _quick_detents++;
+    }
+    _last_direction = direction;
+
+    if(_quick_detents < TUNING_ACCEL_RUN)
+        return vfo->_step;
+    if(interval <= TUNING_ACCEL_FAST_INTERVAL)
+        return vfo->_step * TUNING_ACCEL_FAST_MULTIPLIER;
+    return vfo->_step * TUNING_ACCEL_MEDIUM_MULTIPLIER;
 }
 
 // does mode-specific handling of the event to modify the mode
@@ -11,14 +36,18 @@ bool VFO_Tuner::event_sink(int event, int event_data){
     VFO *vfo = (VFO*) _mode;
 
     unsigned long _old_freq = vfo->_frequency;
+    if(event != 1 && event != -1)
+        return true;
+
+    unsigned long step = tuning_step(event, (unsigned int)event_data);
     if(event == 1){
-        vfo->_frequency += vfo->_step;
+        vfo->_frequency += step;
         if(_old_freq > vfo->_frequency){
             // unsigned long wrapped up??
             vfo->_frequency = (unsigned long)-1L;
         }        
     } else if(event == -1){
-        vfo->_frequency -= vfo->_step;
+        vfo->_frequency -= step;
         if(_old_freq < vfo->_frequency){
             // unsigned long wrapped down??
             vfo->_frequency = 0;
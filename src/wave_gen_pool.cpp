@@ -1,11 +1,16 @@
 #include "basic_types.h"
 #include "wave_gen_pool.h"
+#include "telemetry.h"
 
 // pass array of wave generator addresses, array of free/in-use bools, count of wave generators 
 WaveGenPool::WaveGenPool(WaveGen **wavegens, bool *statuses,  int nwavegens){
     _realizers = wavegens;
     _statuses = statuses;
     _nrealizers = nwavegens;
+#ifdef ENABLE_PIPELINE_STATS
+    _acquired = 0;
+    _failed = 0;
+#endif
 
     for(int i = 0; i < _nrealizers; i++){
         free_realizer(i, 0);  // Initialize with station_id 0
@@ -16,15 +21,24 @@ int WaveGenPool::get_realizer(int station_id){
     for(int i = 0; i < _nrealizers; i++){
         if(!_statuses[i]){
             _statuses[i] = true;
+#ifdef ENABLE_PIPELINE_STATS
+            _acquired++;
+#endif
+            TELEMETRY(TELEMETRY_GRANT, station_id, i);
             return i;
         }
     }
+#ifdef ENABLE_PIPELINE_STATS
+    _failed++;
+#endif
+    TELEMETRY(TELEMETRY_DENY, station_id, 0);
     return -1;
 }
 
 // multiplely gotten realizers must be freed individually
 void WaveGenPool::free_realizer(int nrealizer, int station_id){
     _statuses[nrealizer] = false;
+    TELEMETRY(TELEMETRY_FREE, station_id, nrealizer);
 }
 
 WaveGen * WaveGenPool::access_realizer(int nrealizer){
@@ -0,0 +1,29 @@
+# PlatformIO post-link check: fails the build if the heap allocator is linked in
+#
+# The firmware allocates everything statically, so the RAM line of the size report is
+# all the RAM it uses apart from the stack. A malloc() anywhere in the sources or
+# libraries (operator new, String, a library constructor) brings the allocator back;
+# this lists the ELF's symbols after linking and names the culprit.
+#
+# Enabled with extra_scripts in platformio.ini.
+
+Import("env")
+
+import subprocess
+
+HEAP_SYMBOLS = {"malloc", "calloc", "realloc", "free", "__brkval"}
+
+
+def check_no_heap(source, target, env):
+    elf = str(target[0])
+    nm = env.subst("$OBJCOPY").replace("objcopy", "nm")
+    output = subprocess.check_output([nm, "--defined-only", elf], env=env["ENV"], universal_newlines=True)
+    linked = sorted({line.split()[-1] for line in output.splitlines()} & HEAP_SYMBOLS)
+    if linked:
+        print("Heap allocator linked into %s: %s" % (elf, ", ".join(linked)))
+        print("Add -Wl,--trace-symbol=malloc to build_flags to see which object calls it")
+        env.Exit(1)
+    print("No heap allocator linked")
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", check_no_heap)
@@ -0,0 +1,183 @@
+// Checks for the AD9833 driver and emulator
+//
+// 1. Drives lib/MD_AD9833_Custom through the SPI decoder and checks that the
+//    registers the chip would end up with match what the driver meant to write
+// 2. Compares every calcFreq() word for 0.1 Hz to 5 kHz (0.1 Hz steps) with the
+//    exactly rounded word, as the baseline for faster calcFreq() versions
+// 3. Checks the emulator's block renderer against a tick-by-tick accumulator
+// 4. Measures the rendered frequency of a 440 Hz tone
+//
+//   pio run -e host_ad9833_check && .pio/build/host_ad9833_check/program
+
+#include <Arduino.h>
+#include <MD_AD9833.h>
+#include "ad9833_emulator.h"
+#include "ad9833_spi_bus.h"
+
+#define PIN_DATA 11
+#define PIN_CLK 13
+#define PIN_FSYNC 8
+#define SAMPLE_RATE 48000
+
+static int failures = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("%-58s %s\n", what, ok ? "ok" : "FAIL");
+    if(!ok)
+        failures++;
+}
+
+static uint32_t expected_word(float frequency)
+{
+    // The driver's formula: FreqReg = f * 2^28 / MCLK, truncated
+    return (uint32_t)((frequency * 268435456.0) / AD9833_DEFAULT_MCLK);
+}
+
+static void check_driver(MD_AD9833 &driver, AD9833Emulator &chip, AD9833SpiBus &bus)
+{
+    driver.begin();
+    check(chip.words() == 7, "begin() sends 7 words");
+    check(!(chip.control() & AD9833_RESET), "begin() leaves RESET clear");
+    check((chip.control() & AD9833_B28) != 0, "begin() selects 28-bit frequency writes");
+    check(chip.frequency(0) == expected_word(1000.0) && chip.frequency(1) == expected_word(1000.0),
+          "begin() loads 1 kHz into FREQ0 and FREQ1");
+
+    driver.setFrequency(MD_AD9833::CHAN_0, 440.0);
+    driver.setFrequency(MD_AD9833::CHAN_1, 1234.5);
+    driver.setActiveFrequency(MD_AD9833::CHAN_1);
+    check(chip.frequency(0) == expected_word(440.0), "setFrequency(CHAN_0, 440) loads FREQ0");
+    check(chip.frequency(1) == expected_word(1234.5), "setFrequency(CHAN_1, 1234.5) loads FREQ1");
+    check((chip.control() & AD9833_FSELECT) != 0, "setActiveFrequency(CHAN_1) sets FSELECT");
+
+    driver.setActiveFrequency(MD_AD9833::CHAN_0);
+    check(!(chip.control() & AD9833_FSELECT), "setActiveFrequency(CHAN_0) clears FSELECT");
+    check(bus.partial_words() == 0 && bus.stray_clocks() == 0, "no partial words or stray clocks");
+}
+
+static void check_calc_freq(MD_AD9833 &driver, AD9833Emulator &chip)
+{
+    long worst = 0;
+    long off = 0;
+    long steps = 0;
+    for(long tenths = 1; tenths <= 50000; tenths++){
+        float frequency = tenths / 10.0f;
+        driver.setFrequency(MD_AD9833::CHAN_0, frequency);
+        long exact = lround((double)frequency * 268435456.0 / AD9833_DEFAULT_MCLK);
+        long error = labs((long)chip.frequency(0) - exact);
+        if(error > worst)
+            worst = error;
+        if(error)
+            off++;
+        steps++;
+    }
+    printf("calcFreq: %ld of %ld words differ from the rounded word, worst %ld LSB (%.3f Hz)\n",
+           off, steps, worst, worst * (double)AD9833_DEFAULT_MCLK / 268435456.0);
+    check(worst <= 1, "calcFreq within 1 LSB of the exact word");
+}
+
+// Tick-by-tick reference: sine DAC code at every point of a block
+static void check_block_render()
+{
+    uint32_t lcg = 12345;
+    auto next = [&lcg]() { lcg = lcg * 1664525UL + 1013904223UL; return lcg; };
+
+    AD9833Emulator chip;
+    chip.write(AD9833_B28 | AD9833_RESET);
+    chip.write(AD9833_B28);
+
+    AD9833Clock clock(AD9833_DEFAULT_MCLK, SAMPLE_RATE, 1);
+    uint32_t ticks[AD9833_BLOCK_MAX];
+    uint32_t reference_acc = 0;
+    long mismatches = 0;
+    long points = 0;
+
+    for(int block = 0; block < 2000; block++){
+        if(block % 50 == 0){
+            // New random frequency, phase and selection, written as the driver would
+            uint32_t word = next() & 0x0FFFFFFF;
+            int index = (next() >> 8) & 1;
+            uint16_t command = index ? 0x8000 : 0x4000;
+            chip.write(command | (word & 0x3FFF));
+            chip.write(command | ((word >> 14) & 0x3FFF));
+            chip.write(0xC000 | (index << 13) | (next() & 0x0FFF));
+            chip.write(AD9833_B28 | (index ? AD9833_FSELECT | AD9833_PSELECT : 0));
+        }
+
+        int count = 48;
+        uint32_t block_ticks = clock.next_block(count, ticks);
+        float mix[AD9833_BLOCK_MAX] = {};
+        chip.render(ticks, count, 1, block_ticks, mix);
+
+        int index = (chip.control() & AD9833_FSELECT) ? 1 : 0;
+        uint32_t freq = chip.frequency(index);
+        uint16_t phase = chip.phase((chip.control() & AD9833_PSELECT) ? 1 : 0);
+        uint32_t acc = reference_acc;
+        uint32_t tick = 0;
+        for(int n = 0; n < count; n++){
+            for(; tick < ticks[n]; tick++)
+                acc = (acc + freq) & AD9833_ACCUMULATOR_MASK;
+            uint16_t code = AD9833Emulator::rom(((acc >> 16) + phase) & 0x0FFF);
+            if(mix[n] != (code - 511.5f) / 511.5f)
+                mismatches++;
+            points++;
+        }
+        for(; tick < block_ticks; tick++)
+            acc = (acc + freq) & AD9833_ACCUMULATOR_MASK;
+        reference_acc = acc;
+    }
+    printf("block render: %ld points, %ld differ from the tick-by-tick accumulator\n", points, mismatches);
+    check(mismatches == 0 && chip.accumulator() == reference_acc, "block render is bit-exact");
+}
+
+static void check_tone(MD_AD9833 &driver, AD9833Emulator &chip)
+{
+    driver.begin();
+    driver.setFrequency(MD_AD9833::CHAN_0, 440.0);
+    driver.setActiveFrequency(MD_AD9833::CHAN_0);
+
+    AD9833Clock clock(AD9833_DEFAULT_MCLK, SAMPLE_RATE, 8);
+    uint32_t ticks[AD9833_BLOCK_MAX * AD9833_OVERSAMPLE_MAX];
+    float last = 0.0f;
+    double first_crossing = -1.0, last_crossing = 0.0;
+    long crossings = 0;
+    for(long sample = 0; sample < 10L * SAMPLE_RATE; sample += 48){
+        float mix[48] = {};
+        uint32_t block_ticks = clock.next_block(48, ticks);
+        chip.render(ticks, 48, 8, block_ticks, mix);
+        for(int n = 0; n < 48; n++){
+            if(last < 0.0f && mix[n] >= 0.0f){
+                double at = sample + n - mix[n] / (mix[n] - last);   // interpolated
+                if(first_crossing < 0.0)
+                    first_crossing = at;
+                else
+                    crossings++;
+                last_crossing = at;
+            }
+            last = mix[n];
+        }
+    }
+    double measured = crossings * (double)SAMPLE_RATE / (last_crossing - first_crossing);
+    double programmed = expected_word(440.0) * (double)AD9833_DEFAULT_MCLK / 268435456.0;
+    printf("440 Hz tone: word %lu is %.4f Hz, rendered %.4f Hz\n",
+           (unsigned long)expected_word(440.0), programmed, measured);
+    check(fabs(measured - programmed) < 0.01, "rendered frequency matches the frequency word");
+}
+
+int main()
+{
+    AD9833Emulator chip;
+    AD9833SpiBus bus(PIN_DATA, PIN_CLK);
+    bus.attach(PIN_FSYNC, &chip);
+    bus.install();
+
+    MD_AD9833 driver(PIN_DATA, PIN_CLK, PIN_FSYNC);
+
+    check_driver(driver, chip, bus);
+    check_calc_freq(driver, chip);
+    check_block_render();
+    check_tone(driver, chip);
+
+    printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,190 @@
+#include <math.h>
+#include <string.h>
+#include "ad9833_emulator.h"
+
+// ============================================================================
+// SINE ROM
+// ============================================================================
+// The ROM maps a 12-bit phase to a 10-bit DAC code; modelled as the rounded sine
+// about midscale, 0-1023
+
+static uint16_t sine_rom[AD9833_ROM_SIZE];
+static float sine_rom_level[AD9833_ROM_SIZE];  // DAC code as output level, -1.0 to 1.0
+
+static void build_sine_rom()
+{
+    if(sine_rom[AD9833_ROM_SIZE / 4])
+        return;
+    for(int i = 0; i < AD9833_ROM_SIZE; i++){
+        long code = lround(511.5 + 511.5 * sin(2.0 * M_PI * i / AD9833_ROM_SIZE));
+        sine_rom[i] = (uint16_t)(code < 0 ? 0 : (code > 1023 ? 1023 : code));
+        sine_rom_level[i] = (sine_rom[i] - 511.5f) / 511.5f;
+    }
+}
+
+uint16_t AD9833Emulator::rom(int address)
+{
+    build_sine_rom();
+    return sine_rom[address & (AD9833_ROM_SIZE - 1)];
+}
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+AD9833Clock::AD9833Clock(uint32_t mclk, uint32_t sample_rate, int oversample)
+{
+    _mclk = mclk;
+    _oversample = oversample < 1 ? 1 : (oversample > AD9833_OVERSAMPLE_MAX ? AD9833_OVERSAMPLE_MAX : oversample);
+    _point_rate = sample_rate * _oversample;
+    _whole = mclk / _point_rate;
+    _fraction = mclk % _point_rate;
+    _phase = 0;
+}
+
+uint32_t AD9833Clock::next_block(int count, uint32_t *ticks)
+{
+    // Point j of the whole run is taken at tick floor(j * mclk / point_rate); the
+    // remainder is carried exactly, so blocks join without drift
+    uint32_t tick = 0;
+    int points = count * _oversample;
+    for(int j = 0; j < points; j++){
+        ticks[j] = tick;
+        tick += _whole;
+        _phase += _fraction;
+        if(_phase >= _point_rate){
+            _phase -= _point_rate;
+            tick++;
+        }
+    }
+    return tick;
+}
+
+// ============================================================================
+// REGISTERS
+// ============================================================================
+
+AD9833Emulator::AD9833Emulator()
+{
+    build_sine_rom();
+    power_on();
+}
+
+void AD9833Emulator::power_on()
+{
+    _control = AD9833_RESET;
+    _freq[0] = _freq[1] = 0;
+    _phase_reg[0] = _phase_reg[1] = 0;
+    _lsb_pending[0] = _lsb_pending[1] = false;
+    _pending_lsb[0] = _pending_lsb[1] = 0;
+    _acc = 0;
+    _words = 0;
+}
+
+void AD9833Emulator::write(uint16_t word)
+{
+    _words++;
+    uint16_t data = word & 0x3FFF;
+
+    switch(word >> 14){
+        case 0:     // control
+            _control = word & 0x3FFF;
+            if(_control & AD9833_RESET)
+                _acc = 0;
+            break;
+
+        case 1:     // FREQ0
+        case 2:     // FREQ1
+        {
+            int index = (word >> 14) - 1;
+            if(_control & AD9833_B28){
+                if(!_lsb_pending[index]){
+                    _pending_lsb[index] = data;
+                    _lsb_pending[index] = true;
+                } else {
+                    _freq[index] = ((uint32_t)data << 14) | _pending_lsb[index];
+                    _lsb_pending[index] = false;
+                }
+            } else if(_control & AD9833_HLB){
+                _freq[index] = (_freq[index] & 0x3FFF) | ((uint32_t)data << 14);
+            } else {
+                _freq[index] = (_freq[index] & 0x0FFFC000UL) | data;
+            }
+            break;
+        }
+
+        case 3:     // PHASE0/PHASE1 (D12 is don't care)
+            _phase_reg[(word >> 13) & 1] = word & 0x0FFF;
+            break;
+    }
+}
+
+// ============================================================================
+// OUTPUT
+// ============================================================================
+
+uint16_t AD9833Emulator::code_for(uint32_t acc, uint16_t phase) const
+{
+    if(_control & (AD9833_RESET | AD9833_SLEEP12))
+        return AD9833_DAC_MIDSCALE;
+
+    uint32_t shifted = (acc + ((uint32_t)phase << 16)) & AD9833_ACCUMULATOR_MASK;
+    if(_control & AD9833_OPBITEN){
+        // Square: accumulator MSB, or MSB divided by two
+        uint32_t bit = (_control & AD9833_DIV2) ? (shifted >> 27) : ((acc >> 28) & 1);
+        return bit ? 1023 : 0;
+    }
+    if(_control & AD9833_MODE){
+        // Triangle: 10-bit ramp up, then down, over one accumulator cycle
+        uint16_t v = shifted >> 17;
+        return v < 1024 ? v : 2047 - v;
+    }
+    return sine_rom[shifted >> 16];
+}
+
+uint16_t AD9833Emulator::dac_code() const
+{
+    return code_for(_acc, _phase_reg[(_control & AD9833_PSELECT) ? 1 : 0]);
+}
+
+void AD9833Emulator::advance(uint32_t ticks)
+{
+    if(clock_running())
+        _acc += _freq[(_control & AD9833_FSELECT) ? 1 : 0] * ticks;
+}
+
+void AD9833Emulator::render(const uint32_t *ticks, int count, int oversample, uint32_t block_ticks, float *mix)
+{
+    if(_control & (AD9833_RESET | AD9833_SLEEP12))
+        return;     // midscale: no output after the coupling capacitor
+
+    int points = count * oversample;
+    uint32_t freq = clock_running() ? _freq[(_control & AD9833_FSELECT) ? 1 : 0] : 0;
+    uint32_t phase = (uint32_t)_phase_reg[(_control & AD9833_PSELECT) ? 1 : 0] << 16;
+    uint32_t acc = _acc;
+    float levels[AD9833_BLOCK_MAX * AD9833_OVERSAMPLE_MAX];
+
+    if(!(_control & (AD9833_OPBITEN | AD9833_MODE))){
+        // Sine: accumulator at each point (mod 2^32 keeps the 28 bits exact), ROM
+        // address from the 12 MSBs plus the phase register
+        uint16_t address[AD9833_BLOCK_MAX * AD9833_OVERSAMPLE_MAX];
+        for(int j = 0; j < points; j++)
+            address[j] = (uint16_t)(((acc + freq * ticks[j] + phase) & AD9833_ACCUMULATOR_MASK) >> 16);
+        for(int j = 0; j < points; j++)
+            levels[j] = sine_rom_level[address[j]];
+    } else {
+        for(int j = 0; j < points; j++)
+            levels[j] = (code_for(acc + freq * ticks[j], phase >> 16) - 511.5f) / 511.5f;
+    }
+
+    // Average each group of points down to one output sample
+    const float scale = 1.0f / oversample;
+    for(int n = 0; n < count; n++){
+        float sum = 0.0f;
+        for(int k = 0; k < oversample; k++)
+            sum += levels[n * oversample + k];
+        mix[n] += sum * scale;
+    }
+
+    _acc = acc + freq * block_ticks;
+}
@@ -0,0 +1,111 @@
+#ifndef __AD9833_EMULATOR_H__
+#define __AD9833_EMULATOR_H__
+
+#include <stdint.h>
+
+// Register and DDS model of one AD9833, fed with the 16-bit words it receives over SPI
+//
+// Follows the datasheet register map:
+// - Control word (D15:D14 = 00): B28, HLB, FSELECT, PSELECT, RESET, SLEEP1, SLEEP12,
+//   OPBITEN, DIV2, MODE
+// - FREQ0/FREQ1 (01/10): with B28 set, two consecutive writes load the 14 LSBs and then
+//   the 14 MSBs, and the register changes only after the second write. With B28 clear,
+//   HLB selects which half a single write replaces.
+// - PHASE0/PHASE1 (11, D13 selects): 12-bit phase offset
+//
+// The 28-bit phase accumulator adds the selected FREQ register once per MCLK cycle.
+// The 12 MSBs of the accumulator plus the selected PHASE register address the sine
+// ROM, whose output drives the 10-bit DAC. RESET holds the accumulator at zero and
+// the output at midscale. SLEEP1 stops MCLK (the accumulator stops) and SLEEP12 powers
+// down the DAC.
+//
+// Output is produced in blocks: AD9833Clock gives the exact MCLK tick of every
+// oversampled point in a block. Each chip computes its accumulator at those ticks
+// directly (acc + FREQ * tick, modulo 2^28), so the loops carry no dependency and
+// vectorize. The points are then averaged down to the audio rate.
+
+#define AD9833_DEFAULT_MCLK 25000000UL
+#define AD9833_ACCUMULATOR_MASK 0x0FFFFFFFUL
+#define AD9833_ROM_SIZE 4096
+#define AD9833_DAC_MIDSCALE 512
+
+#define AD9833_BLOCK_MAX 256        // output samples per block
+#define AD9833_OVERSAMPLE_MAX 16
+
+// Control register bits
+#define AD9833_B28      (1 << 13)
+#define AD9833_HLB      (1 << 12)
+#define AD9833_FSELECT  (1 << 11)
+#define AD9833_PSELECT  (1 << 10)
+#define AD9833_RESET    (1 << 8)
+#define AD9833_SLEEP1   (1 << 7)
+#define AD9833_SLEEP12  (1 << 6)
+#define AD9833_OPBITEN  (1 << 5)
+#define AD9833_DIV2     (1 << 3)
+#define AD9833_MODE     (1 << 1)
+
+// MCLK ticks of the oversampled points in consecutive blocks, shared by all chips
+class AD9833Clock
+{
+public:
+    AD9833Clock(uint32_t mclk, uint32_t sample_rate, int oversample);
+
+    // Fills ticks[] for count output samples and returns the block length in MCLK ticks.
+    // ticks[j] is the offset from the block start at which point j is taken.
+    uint32_t next_block(int count, uint32_t *ticks);
+
+    int oversample() const { return _oversample; }
+
+private:
+    uint32_t _mclk;
+    uint32_t _point_rate;       // sample_rate * oversample
+    int _oversample;
+    uint32_t _whole;            // MCLK ticks per point, whole part
+    uint32_t _fraction;         // remainder, in 1/_point_rate ticks
+    uint32_t _phase;            // running remainder
+};
+
+class AD9833Emulator
+{
+public:
+    AD9833Emulator();
+
+    // Power-on state: registers cleared, RESET set
+    void power_on();
+
+    // One complete 16-bit SPI word (FSYNC low for 16 falling SCLK edges)
+    void write(uint16_t word);
+
+    // Adds count output samples to mix (1.0 = full scale), taking ticks[] from AD9833Clock
+    void render(const uint32_t *ticks, int count, int oversample, uint32_t block_ticks, float *mix);
+
+    // Advances the accumulator without producing output
+    void advance(uint32_t ticks);
+
+    // DAC code (0-1023) for the current accumulator state
+    uint16_t dac_code() const;
+
+    uint16_t control() const { return _control; }
+    uint32_t frequency(int index) const { return _freq[index]; }
+    uint32_t active_frequency() const { return _freq[(_control & AD9833_FSELECT) ? 1 : 0]; }
+    uint16_t phase(int index) const { return _phase_reg[index]; }
+    uint32_t accumulator() const { return _acc & AD9833_ACCUMULATOR_MASK; }
+    unsigned long words() const { return _words; }
+
+    // Sine ROM contents: 10-bit DAC code for each 12-bit phase
+    static uint16_t rom(int address);
+
+private:
+    uint16_t code_for(uint32_t acc, uint16_t phase) const;
+    bool clock_running() const { return !(_control & (AD9833_RESET | AD9833_SLEEP1)); }
+
+    uint16_t _control;
+    uint32_t _freq[2];
+    uint16_t _phase_reg[2];
+    bool _lsb_pending[2];       // B28 mode: LSB half written, waiting for MSB half
+    uint16_t _pending_lsb[2];
+    uint32_t _acc;              // 28-bit accumulator; bit 28 is the DIV2 = 0 square divider
+    unsigned long _words;
+};
+
+#endif // __AD9833_EMULATOR_H__
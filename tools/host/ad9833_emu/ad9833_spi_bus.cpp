@@ -0,0 +1,83 @@
+#include <Arduino.h>
+#include "ad9833_spi_bus.h"
+
+static AD9833SpiBus *installed_bus = nullptr;
+
+static void bus_pin_hook(uint8_t pin, uint8_t level)
+{
+    installed_bus->pin_changed(pin, level);
+}
+
+AD9833SpiBus::AD9833SpiBus(uint8_t data_pin, uint8_t clk_pin)
+{
+    _data_pin = data_pin;
+    _clk_pin = clk_pin;
+    _data = LOW;
+    _clk = HIGH;        // SCLK idles high
+    _count = 0;
+    _partial_words = 0;
+    _stray_clocks = 0;
+}
+
+void AD9833SpiBus::attach(uint8_t fsync_pin, AD9833Emulator *chip)
+{
+    if(_count >= AD9833_SPI_MAX_CHIPS)
+        return;
+    Device &device = _devices[_count++];
+    device.fsync_pin = fsync_pin;
+    device.selected = false;
+    device.bits = 0;
+    device.shift = 0;
+    device.chip = chip;
+}
+
+void AD9833SpiBus::install()
+{
+    installed_bus = this;
+    mock_set_pin_hook(bus_pin_hook);
+}
+
+void AD9833SpiBus::pin_changed(uint8_t pin, uint8_t level)
+{
+    if(pin == _data_pin){
+        _data = level;
+        return;
+    }
+
+    if(pin == _clk_pin){
+        bool falling = _clk == HIGH && level == LOW;
+        _clk = level;
+        if(!falling)
+            return;
+
+        bool any = false;
+        for(int i = 0; i < _count; i++){
+            Device &device = _devices[i];
+            if(!device.selected)
+                continue;
+            any = true;
+            device.shift = (device.shift << 1) | _data;
+            if(++device.bits == 16){
+                device.chip->write(device.shift);
+                device.bits = 0;
+            }
+        }
+        if(!any)
+            _stray_clocks++;
+        return;
+    }
+
+    for(int i = 0; i < _count; i++){
+        Device &device = _devices[i];
+        if(pin != device.fsync_pin)
+            continue;
+        bool selected = level == LOW;
+        if(selected && !device.selected){
+            device.bits = 0;
+            device.shift = 0;
+        } else if(!selected && device.selected && device.bits){
+            _partial_words++;
+        }
+        device.selected = selected;
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef __AD9833_SPI_BUS_H__
+#define __AD9833_SPI_BUS_H__
+
+#include <stdint.h>
+#include "ad9833_emulator.h"
+
+// Decodes bit-banged SPI from the host digitalWrite() hook into AD9833 words
+//
+// The chips share DATA and SCLK and each has its own FSYNC, as on the board. While a
+// chip's FSYNC is low, each falling SCLK edge shifts in the DATA level, MSB first.
+// The 16th edge delivers the word to the chip's emulator. Raising FSYNC early
+// discards a partial word, as the AD9833 does. Bits clocked while no FSYNC is low
+// are counted as stray clocks.
+
+#define AD9833_SPI_MAX_CHIPS 8
+
+class AD9833SpiBus
+{
+public:
+    AD9833SpiBus(uint8_t data_pin, uint8_t clk_pin);
+
+    void attach(uint8_t fsync_pin, AD9833Emulator *chip);
+
+    // Routes mock digitalWrite() calls to the bus (one bus at a time)
+    void install();
+
+    void pin_changed(uint8_t pin, uint8_t level);
+
+    unsigned long partial_words() const { return _partial_words; }
+    unsigned long stray_clocks() const { return _stray_clocks; }
+
+private:
+    struct Device
+    {
+        uint8_t fsync_pin;
+        bool selected;
+        uint8_t bits;
+        uint16_t shift;
+        AD9833Emulator *chip;
+    };
+
+    uint8_t _data_pin;
+    uint8_t _clk_pin;
+    uint8_t _data;
+    uint8_t _clk;
+    Device _devices[AD9833_SPI_MAX_CHIPS];
+    int _count;
+    unsigned long _partial_words;
+    unsigned long _stray_clocks;
+};
+
+#endif // __AD9833_SPI_BUS_H__
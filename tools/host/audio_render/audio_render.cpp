@@ -0,0 +1,207 @@
+// Offline audio renderer for the station simulation
+//
+// Runs the firmware station simulation (tools/host/sim) on the virtual clock, one
+// main loop pass per millisecond. After each pass it copies every AD9833's active
+// frequency word into an oscillator and renders that millisecond of audio. The four
+// chip outputs are summed as on the board, AC coupled (the output capacitor,
+// modelled as a 10 Hz high-pass) and written as 16-bit mono WAV.
+//
+//   pio run -e host_audio_render
+//   .pio/build/host_audio_render/program -o exchange.wav -s 60
+//
+// Options:
+//   -o file     output WAV (default render.wav)
+//   -s seconds  length (default 60)
+//   -r rate     sample rate (default 48000)
+//   -f hz       VFO frequency (default 555123400, VFO A)
+//   -t hz       tune the VFO by this many Hz per second (default 0)
+//   -seed n     base seed for the station random streams (default 1)
+//   -i file     also write what each station meant to send (see intent_log.h), for
+//               checking the render with tools/host/tone_check
+//
+// The same seed and options always produce the same file, so a render can be kept
+// as a regression artifact and compared after a change.
+//
+// Built with HOST_AD9833_SPI (env host_audio_render_emulated) the chips are driven by
+// lib/MD_AD9833_Custom instead of the register mock. The bit-banged SPI is decoded into
+// AD9833 emulators (tools/host/ad9833_emu), which render the 28-bit accumulator, the
+// 12-bit sine ROM address and the 10-bit DAC at MCLK ticks, oversampled and averaged
+// down to the output rate:
+//   -x n        oversampling, 1 to 16 (default 4)
+
+#include <Arduino.h>
+#include <chrono>
+#include "station_sim.h"
+#include "wav_writer.h"
+#include "intent_log.h"
+#ifdef HOST_AD9833_SPI
+#include "ad9833_emulator.h"
+#include "ad9833_spi_bus.h"
+#else
+#include "oscillator_bank.h"
+#endif
+
+#define DEFAULT_SAMPLE_RATE 48000
+#define OUTPUT_HIGHPASS_HZ 10.0
+#define OUTPUT_GAIN (0.9f * 32767.0f / STATION_SIM_AD9833_COUNT)
+#define DEFAULT_OVERSAMPLE 4
+
+#ifdef HOST_AD9833_SPI
+#define RENDER_BLOCK_MAX AD9833_BLOCK_MAX
+#else
+#define RENDER_BLOCK_MAX OSCILLATOR_BLOCK_MAX
+#endif
+
+struct RenderOptions
+{
+    const char *path = "render.wav";
+    const char *intent_path = nullptr;
+    unsigned long seconds = 60;
+    unsigned long sample_rate = DEFAULT_SAMPLE_RATE;
+    unsigned long vfo_frequency = 555123400UL;
+    long tune_rate = 0;
+    uint32_t seed = 1;
+    int oversample = DEFAULT_OVERSAMPLE;
+};
+
+static bool parse_options(int argc, char **argv, RenderOptions &options)
+{
+    for(int i = 1; i < argc; i++){
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if(!value)
+            return false;
+        if(!strcmp(arg, "-o"))
+            options.path = value;
+        else if(!strcmp(arg, "-s"))
+            options.seconds = strtoul(value, nullptr, 0);
+        else if(!strcmp(arg, "-r"))
+            options.sample_rate = strtoul(value, nullptr, 0);
+        else if(!strcmp(arg, "-f"))
+            options.vfo_frequency = strtoul(value, nullptr, 0);
+        else if(!strcmp(arg, "-t"))
+            options.tune_rate = strtol(value, nullptr, 0);
+        else if(!strcmp(arg, "-seed"))
+            options.seed = strtoul(value, nullptr, 0);
+        else if(!strcmp(arg, "-i"))
+            options.intent_path = value;
+        else if(!strcmp(arg, "-x"))
+            options.oversample = atoi(value);
+        else
+            return false;
+        i++;
+    }
+    return options.seconds > 0 && options.sample_rate >= 8000 &&
+           options.oversample >= 1 && options.oversample <= 16;
+}
+
+int main(int argc, char **argv)
+{
+    RenderOptions options;
+    if(!parse_options(argc, argv, options)){
+        fprintf(stderr, "usage: %s [-o file.wav] [-s seconds] [-r rate] [-f vfo_hz] [-t hz_per_second] [-seed n] [-i intent] [-x oversample]\n", argv[0]);
+        return 1;
+    }
+
+    WavWriter wav;
+    if(!wav.open(options.path, options.sample_rate)){
+        fprintf(stderr, "cannot write %s\n", options.path);
+        return 1;
+    }
+
+    auto started = std::chrono::steady_clock::now();
+
+#ifdef HOST_AD9833_SPI
+    // The chips listen on the simulation's pins before setup() resets them
+    static AD9833Emulator chips[STATION_SIM_AD9833_COUNT];
+    AD9833SpiBus bus(STATION_SIM_DATA_PIN, STATION_SIM_CLK_PIN);
+    for(int i = 0; i < STATION_SIM_AD9833_COUNT; i++)
+        bus.attach(station_sim_fsync_pins[i], &chips[i]);
+    bus.install();
+    AD9833Clock clock(AD9833_DEFAULT_MCLK, options.sample_rate, options.oversample);
+    static uint32_t ticks[AD9833_BLOCK_MAX * AD9833_OVERSAMPLE_MAX];
+#else
+    OscillatorBank oscillators(STATION_SIM_AD9833_COUNT, MOCK_AD9833_MCLK, options.sample_rate);
+#endif
+    station_sim_begin(options.seed, options.vfo_frequency);
+
+    IntentLog intent;
+    if(options.intent_path && !intent.open(options.intent_path, options.path)){
+        fprintf(stderr, "cannot write %s\n", options.intent_path);
+        return 1;
+    }
+
+    // One-pole DC blocker standing in for the output coupling capacitor
+    const float highpass = (float)(1.0 - 2.0 * M_PI * OUTPUT_HIGHPASS_HZ / options.sample_rate);
+    float last_in = 0.0f, last_out = 0.0f;
+
+    float mix[RENDER_BLOCK_MAX];
+    int16_t pcm[RENDER_BLOCK_MAX];
+    unsigned long long samples_done = 0;
+    unsigned long duration = options.seconds * 1000UL;
+    unsigned long frequency_changes = 0;
+    uint32_t last_words[STATION_SIM_AD9833_COUNT] = {};
+
+    for(unsigned long time = 0; time < duration; time++){
+        if(options.tune_rate && time % STATION_SIM_FRAME_INTERVAL == 0)
+            station_sim_tune(options.vfo_frequency + (long long)options.tune_rate * (long)time / 1000);
+        station_sim_step(time);
+        intent.sample(time);
+
+        // Samples that fall in this millisecond (exact for rates that are not multiples of 1000)
+        unsigned long long samples_end = (unsigned long long)(time + 1) * options.sample_rate / 1000;
+        int count = (int)(samples_end - samples_done);
+        samples_done = samples_end;
+        memset(mix, 0, count * sizeof(float));
+
+#ifdef HOST_AD9833_SPI
+        uint32_t block_ticks = clock.next_block(count, ticks);
+        for(int i = 0; i < STATION_SIM_AD9833_COUNT; i++){
+            uint32_t word = chips[i].active_frequency();
+            if(word != last_words[i]){
+                frequency_changes++;
+                last_words[i] = word;
+            }
+            chips[i].render(ticks, count, options.oversample, block_ticks, mix);
+        }
+#else
+        for(int i = 0; i < STATION_SIM_AD9833_COUNT; i++){
+            MD_AD9833 *chip = station_sim_ad9833[i];
+            uint32_t word = chip->active_word();
+            if(word != last_words[i]){
+                frequency_changes++;
+                last_words[i] = word;
+            }
+            oscillators.set_frequency_word(i, word, chip->is_reset());
+        }
+        oscillators.render(mix, count);
+#endif
+
+        for(int n = 0; n < count; n++){
+            float out = mix[n] - last_in + highpass * last_out;
+            last_in = mix[n];
+            last_out = out;
+            float scaled = out * OUTPUT_GAIN;
+            scaled = scaled > 32767.0f ? 32767.0f : (scaled < -32768.0f ? -32768.0f : scaled);
+            pcm[n] = (int16_t)lrintf(scaled);
+        }
+        wav.write(pcm, count);
+    }
+
+    uint32_t samples = wav.samples();
+    wav.close();
+    intent.close(duration);
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+#ifdef HOST_AD9833_SPI
+    unsigned long words = 0;
+    for(int i = 0; i < STATION_SIM_AD9833_COUNT; i++)
+        words += chips[i].words();
+    printf("SPI: %lu words, %lu partial words, %lu stray clocks, oversample %d\n",
+           words, bus.partial_words(), bus.stray_clocks(), options.oversample);
+#endif
+    printf("%s: %lu s, %lu Hz, %u samples, %lu frequency changes\n",
+           options.path, options.seconds, options.sample_rate, samples, frequency_changes);
+    printf("rendered in %.2f s (%.0fx real time)\n", elapsed, options.seconds / elapsed);
+    return 0;
+}
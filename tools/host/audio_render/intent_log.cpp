@@ -0,0 +1,93 @@
+#include "intent_log.h"
+#include "sim_telco.h"
+#include "sim_dtmf.h"
+
+static const char *telco_label(TelcoType type)
+{
+    switch(type){
+        case TELCO_RINGBACK: return "RINGBACK";
+        case TELCO_BUSY:     return "BUSY";
+        case TELCO_REORDER:  return "REORDER";
+        case TELCO_DIALTONE: return "DIALTONE";
+    }
+    return "UNKNOWN";
+}
+
+IntentLog::IntentLog()
+    : _file(nullptr), _tones(0)
+{
+    memset(_current, 0, sizeof(_current));
+    memset(_numbers, 0, sizeof(_numbers));
+}
+
+bool IntentLog::open(const char *path, const char *wav_path)
+{
+    _file = fopen(path, "w");
+    if(!_file)
+        return false;
+
+    fprintf(_file, "# intent for %s\n", wav_path);
+    for(int i = 0; i < STATION_COUNT; i++){
+        const StationSimStation &entry = station_sim_stations[i];
+        fprintf(_file, "station %d %s %s\n", i, entry.telco ? "telco" : "dtmf", entry.name);
+    }
+    return true;
+}
+
+void IntentLog::sample(unsigned long time)
+{
+    if(!_file)
+        return;
+
+    for(int i = 0; i < STATION_COUNT; i++){
+        const StationSimStation &entry = station_sim_stations[i];
+        SimDualTone *station = entry.station;
+
+        Tone now;
+        now.on = station->isActive() && station->has_all_realizers();
+        now.label[0] = '\0';
+        now.freq_a = station->get_frequency_a();
+        now.freq_c = station->get_frequency_c();
+
+        if(entry.dtmf){
+            if(strcmp(entry.dtmf->_generated_number, _numbers[i])){
+                strcpy(_numbers[i], entry.dtmf->_generated_number);
+                fprintf(_file, "number %d %lu %s\n", i, time, _numbers[i]);
+            }
+            now.label[0] = entry.dtmf->_dtmf.get_current_digit();
+            now.label[1] = '\0';
+        } else {
+            strcpy(now.label, telco_label(entry.telco->get_telco_type()));
+        }
+
+        Tone &current = _current[i];
+        if(now.on == current.on &&
+           (!now.on || (!strcmp(now.label, current.label) && now.freq_a == current.freq_a && now.freq_c == current.freq_c)))
+            continue;
+
+        end_tone(i, time);
+        current = now;
+        current.start = time;
+    }
+}
+
+void IntentLog::close(unsigned long time)
+{
+    if(!_file)
+        return;
+    for(int i = 0; i < STATION_COUNT; i++)
+        end_tone(i, time);
+    fclose(_file);
+    _file = nullptr;
+}
+
+void IntentLog::end_tone(int index, unsigned long time)
+{
+    Tone &current = _current[index];
+    if(!current.on)
+        return;
+    fprintf(_file, "tone %d %lu %lu %s %.2f %.2f\n",
+            index, current.start, time, current.label, current.freq_a, current.freq_c);
+    current.on = false;
+    _tones++;
+}
@@ -0,0 +1,51 @@
+#ifndef __INTENT_LOG_H__
+#define __INTENT_LOG_H__
+
+#include <stdio.h>
+#include "station_sim.h"
+
+// Records what each station meant to send, next to a render, for tools/host/tone_check
+//
+// sample() runs after every station_sim_step(). A station is sending while it is active
+// and holds its generators. Each stretch of one tone at one pair of audio frequencies
+// becomes one "tone" line. A change of label or frequency starts a new line. DTMF
+// stations also log the number they dial (SimDTMF::_generated_number) whenever it
+// changes.
+//
+//   station <index> <telco|dtmf> <name>
+//   number <index> <time_ms> <digits>
+//   tone <index> <start_ms> <end_ms> <label> <freq_a> <freq_c>
+//
+// label is the digit for DTMF and RINGBACK, BUSY, REORDER or DIALTONE for telco
+// stations. The frequencies are the generator audio frequencies in Hz.
+
+class IntentLog
+{
+public:
+    IntentLog();
+
+    bool open(const char *path, const char *wav_path);
+    void sample(unsigned long time);
+    void close(unsigned long time);     // ends open tones at time
+
+    unsigned long tones() const { return _tones; }
+
+private:
+    struct Tone
+    {
+        bool on;
+        char label[12];
+        float freq_a;
+        float freq_c;
+        unsigned long start;
+    };
+
+    void end_tone(int index, unsigned long time);
+
+    FILE *_file;
+    Tone _current[STATION_COUNT];
+    char _numbers[STATION_COUNT][12];
+    unsigned long _tones;
+};
+
+#endif // __INTENT_LOG_H__
@@ -0,0 +1,37 @@
+#ifndef __OSCILLATOR_BANK_H__
+#define __OSCILLATOR_BANK_H__
+
+#include <stdint.h>
+
+// Sine oscillators for the AD9833 outputs, mixed into a float block
+//
+// Each oscillator keeps a 32-bit phase (the AD9833's 28-bit accumulator scaled by 16)
+// that carries across frequency changes, as the chip's accumulator does. A block is
+// rendered with the phase of each sample computed directly (phase + n * increment),
+// and the sine with a folded odd polynomial, so the inner loops have no carried
+// dependency or table lookup and compile to SIMD code.
+
+#define OSCILLATOR_BANK_MAX 8
+#define OSCILLATOR_BLOCK_MAX 256
+
+class OscillatorBank
+{
+public:
+    OscillatorBank(int count, double mclk, double sample_rate);
+
+    // 28-bit AD9833 frequency word for an oscillator; a reset chip outputs midscale
+    void set_frequency_word(int index, uint32_t word, bool reset = false);
+
+    // Adds count samples (count <= OSCILLATOR_BLOCK_MAX) of every running
+    // oscillator into mix, each at amplitude 1.0
+    void render(float *mix, int count);
+
+private:
+    int _count;
+    double _increment_per_word;
+    uint32_t _phase[OSCILLATOR_BANK_MAX];
+    uint32_t _increment[OSCILLATOR_BANK_MAX];
+    bool _running[OSCILLATOR_BANK_MAX];
+};
+
+#endif // __OSCILLATOR_BANK_H__
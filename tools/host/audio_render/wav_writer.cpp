@@ -0,0 +1,61 @@
+#include <string.h>
+#include "wav_writer.h"
+
+static void put_u16(uint8_t *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void put_u32(uint8_t *p, uint32_t v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; }
+
+bool WavWriter::open(const char *path, uint32_t sample_rate)
+{
+    close();
+    _file = fopen(path, "wb");
+    if(!_file)
+        return false;
+    _samples = 0;
+    _sample_rate = sample_rate;
+    setvbuf(_file, nullptr, _IOFBF, 1 << 20);
+    write_header();
+    return true;
+}
+
+void WavWriter::write(const int16_t *samples, int count)
+{
+    uint8_t buffer[2 * 512];
+    while(count > 0){
+        int n = count < 512 ? count : 512;
+        for(int i = 0; i < n; i++)
+            put_u16(buffer + 2 * i, (uint16_t)samples[i]);     // little endian on any host
+        fwrite(buffer, 2, n, _file);
+        samples += n;
+        count -= n;
+        _samples += n;
+    }
+}
+
+void WavWriter::close()
+{
+    if(!_file)
+        return;
+    fseek(_file, 0, SEEK_SET);
+    write_header();
+    fclose(_file);
+    _file = nullptr;
+}
+
+void WavWriter::write_header()
+{
+    uint8_t header[44];
+    uint32_t data_bytes = _samples * 2;
+    memcpy(header, "RIFF", 4);
+    put_u32(header + 4, 36 + data_bytes);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    put_u32(header + 16, 16);               // fmt chunk size
+    put_u16(header + 20, 1);                // PCM
+    put_u16(header + 22, 1);                // mono
+    put_u32(header + 24, _sample_rate);
+    put_u32(header + 28, _sample_rate * 2); // byte rate
+    put_u16(header + 32, 2);                // block align
+    put_u16(header + 34, 16);               // bits per sample
+    memcpy(header + 36, "data", 4);
+    put_u32(header + 40, data_bytes);
+    fwrite(header, 1, sizeof(header), _file);
+}
@@ -0,0 +1,27 @@
+#ifndef __WAV_WRITER_H__
+#define __WAV_WRITER_H__
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Mono 16-bit PCM WAV file; the header sizes are filled in by close()
+class WavWriter
+{
+public:
+    WavWriter() : _file(nullptr), _samples(0), _sample_rate(0) {}
+    ~WavWriter() { close(); }
+
+    bool open(const char *path, uint32_t sample_rate);
+    void write(const int16_t *samples, int count);
+    void close();
+    uint32_t samples() const { return _samples; }
+
+private:
+    void write_header();
+
+    FILE *_file;
+    uint32_t _samples;
+    uint32_t _sample_rate;
+};
+
+#endif // __WAV_WRITER_H__
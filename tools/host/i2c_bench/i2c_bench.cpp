@@ -0,0 +1,65 @@
+// I2C traffic benchmark for HT16K33Disp
+//
+// Runs the display paths the firmware uses against the counting TwoWire mock and
+// prints transactions, bytes and estimated bus time for each.
+// Build with -DHT16K33Disp_UNBUFFERED to measure the original per-digit writes.
+//
+//   pio run -e host_i2c_bench && .pio/build/host_i2c_bench/program
+//   pio run -e host_i2c_bench_unbuffered && .pio/build/host_i2c_bench_unbuffered/program
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <HT16K33Disp.h>
+
+static HT16K33Disp display(0x70, 2);
+
+static void report(const char *name)
+{
+    printf("%-28s %6lu txn %7lu bytes %8lu us (max %lu bytes/txn)\n",
+           name, Wire.transactions(), Wire.bytes(), Wire.bus_micros(), Wire.max_transaction_bytes());
+    Wire.reset_counters();
+}
+
+int main()
+{
+    const byte brightness[] = {2, 2};
+    Wire.setClock(100000);
+
+#ifdef HT16K33Disp_UNBUFFERED
+    printf("HT16K33Disp per-digit writes (unbuffered)\n");
+#else
+    printf("HT16K33Disp framebuffer writes\n");
+#endif
+
+    Wire.reset_counters();
+    display.init(brightness);
+    report("init");
+
+    display.clear();
+    report("clear (already blank)");
+
+    display.segments_test();
+    report("segments_test");
+
+    display.scroll_string("FLuXTeLE", 1, 1);
+    report("scroll_string short");
+
+    display.scroll_string("TeLEPHONE EXCHANGE SIMULATOR", 1, 1);
+    report("scroll_string long");
+
+    // Non-blocking scroll as used by the title display
+    display.begin_scroll_string("SETTINGS MENU", 1, 1);
+    while(display.step_scroll_string(millis()))
+        ;
+    report("step_scroll_string");
+
+    // Tuning: frequency display where only the last digit changes per detent
+    char text[16];
+    for(int detent = 0; detent < 100; detent++){
+        sprintf(text, "7.%06d", 100000 + detent * 10);
+        display.show_string(text);
+    }
+    report("100 tuning detents");
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+// Host replay of input traces captured with ENABLE_INPUT_TRACE
+//
+// Runs the firmware's own setup() and loop() from src/main.cpp on the virtual clock,
+// one loop pass per millisecond, and feeds the recorded input back in at its original
+// times:
+//
+//   - detents are pushed into input_events, as the encoder interrupts do on the device
+//   - button edges set the button pin, so the polled decoder produces presses and long
+//     press repeats as it does for a real button
+//
+// Every application switch the device recorded is checked against the replay, and
+// the titles that follow each switch are timed, since tuning is ignored while they
+// scroll. The report counts AD9833 register writes and display I2C bytes, which depend only on the
+// input, and times each loop pass on the host, so the same knob-spinning can be
+// replayed before and after a change.
+//
+//   pio run -e host_input_replay
+//   .pio/build/host_input_replay/program capture.bin
+//   .pio/build/host_input_replay/program -f tuning.txt capture.bin    (trace for pipeline_eval)
+//
+// Options:
+//   -d          print the decoded records
+//   -f file     write the VFO frequency whenever it changes ("time_ms frequency_hz")
+//   -t ms       fail if the titles after an application switch run longer than this
+//   -x ms       keep running after the last record (default 2000)
+//
+// Settings start from the saved defaults, not from the device's EEPROM.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <MD_AD9833.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "input_events.h"
+#include "input_trace.h"
+#include "event_dispatcher.h"
+#include "vfo.h"
+#include "saved_data.h"
+#include "input_trace_log.h"
+
+// From src/main.cpp
+void setup();
+void loop();
+extern EventDispatcher dispatcher1;
+extern EventDispatcher *dispatcher;
+extern int current_dispatcher;
+
+// Encoder button pins, as SWA and SWB in src/main.cpp
+static const uint8_t button_pins[] = {4, 7};
+
+#define DEFAULT_EXTRA_TIME 2000
+#define SLOWEST_PASSES 5
+
+struct Pass
+{
+    unsigned long time;
+    double us;
+};
+
+static unsigned long vfo_frequency()
+{
+    if(dispatcher != &dispatcher1 || !dispatcher->get_current_mode())
+        return 0;
+    return static_cast<VFO *>(dispatcher->get_current_mode())->_frequency;
+}
+
+int main(int argc, char **argv)
+{
+    bool dump = false;
+    const char *frequency_path = nullptr;
+    unsigned long extra_time = DEFAULT_EXTRA_TIME;
+    unsigned long title_limit = 0;
+    const char *trace_path = nullptr;
+
+    bool ok = true;
+    for(int i = 1; i < argc && ok; i++){
+        if(!strcmp(argv[i], "-d"))
+            dump = true;
+        else if(!strcmp(argv[i], "-f") && i + 1 < argc)
+            frequency_path = argv[++i];
+        else if(!strcmp(argv[i], "-t") && i + 1 < argc)
+            title_limit = strtoul(argv[++i], nullptr, 0);
+        else if(!strcmp(argv[i], "-x") && i + 1 < argc)
+            extra_time = strtoul(argv[++i], nullptr, 0);
+        else if(argv[i][0] != '-' && !trace_path)
+            trace_path = argv[i];
+        else
+            ok = false;
+    }
+    if(!ok || !trace_path){
+        fprintf(stderr, "usage: %s [-d] [-f frequencies.txt] [-t ms] [-x ms] capture.bin\n", argv[0]);
+        return 1;
+    }
+
+    InputTraceLog log;
+    if(!log.load(trace_path)){
+        fprintf(stderr, "%s: no %s input trace\n", trace_path, INPUT_TRACE_MAGIC);
+        return 1;
+    }
+    const std::vector<InputTraceRecord> &records = log.records();
+
+    unsigned long kinds[INPUT_TRACE_LOST + 1] = {};
+    unsigned long lost = 0;
+    for(const InputTraceRecord &record : records){
+        kinds[record.kind]++;
+        if(record.kind == INPUT_TRACE_LOST)
+            lost += record.value;
+        if(dump){
+            printf("%10lu %-6s", record.time, InputTraceLog::kind_name(record.kind));
+            if(record.kind >= INPUT_TRACE_APP)
+                printf(" %u", record.value);
+            printf("\n");
+        }
+    }
+
+    FILE *frequency_file = nullptr;
+    if(frequency_path && !(frequency_file = fopen(frequency_path, "w"))){
+        fprintf(stderr, "cannot write %s\n", frequency_path);
+        return 1;
+    }
+
+    // An erased EEPROM makes setup() store the defaults and reset the device, so start
+    // from the defaults already saved, as on the boot after that reset
+    save_data();
+    mock_set_micros(log.start_time() * 1000UL);
+    setup();
+    Wire.reset_counters();
+
+    unsigned long start = millis();
+    unsigned long end = std::max(start, log.end_time()) + extra_time;
+    size_t next = 0;
+    unsigned long switches = 0, matched = 0, first_mismatch = 0;
+    unsigned long last_frequency = 0;
+    EventDispatcher *last_dispatcher = dispatcher;
+    bool title_running = false;
+    unsigned long title_start = 0, longest_title = 0, longest_title_time = 0;
+    std::vector<Pass> passes;
+    passes.reserve(end - start);
+
+    // Records from before the first loop pass (during setup) apply to the first pass
+    for(unsigned long time = start; time < end; time++){
+        mock_set_micros(time * 1000UL);
+
+        std::vector<const InputTraceRecord *> switches_now;
+        for(; next < records.size() && records[next].time <= time; next++){
+            const InputTraceRecord &record = records[next];
+            byte id = record.kind & 1;
+            switch(record.kind & ~1){
+                case INPUT_TRACE_CW:
+                    input_events.push(id, INPUT_EVENT_ROTATE, 1, time);
+                    break;
+                case INPUT_TRACE_CCW:
+                    input_events.push(id, INPUT_EVENT_ROTATE, -1, time);
+                    break;
+                case INPUT_TRACE_DOWN:
+                    digitalWrite(button_pins[id], LOW);
+                    break;
+                case INPUT_TRACE_UP:
+                    digitalWrite(button_pins[id], HIGH);
+                    break;
+                default:
+                    if(record.kind == INPUT_TRACE_APP)
+                        switches_now.push_back(&record);
+                    break;
+            }
+        }
+
+        auto pass_start = std::chrono::steady_clock::now();
+        loop();
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - pass_start).count();
+        passes.push_back({time, us});
+
+        // The device records the switch in the pass that handles the press
+        for(const InputTraceRecord *record : switches_now){
+            switches++;
+            if(current_dispatcher == record->value)
+                matched++;
+            else if(!first_mismatch)
+                first_mismatch = time;
+        }
+
+        // Titles queued by a switch, up to the end of the mode title
+        if(dispatcher != last_dispatcher){
+            last_dispatcher = dispatcher;
+            title_running = true;
+            title_start = time;
+        }
+        if(title_running && !dispatcher->is_showing_title()){
+            title_running = false;
+            if(time - title_start > longest_title){
+                longest_title = time - title_start;
+                longest_title_time = title_start;
+            }
+        }
+
+        unsigned long frequency = vfo_frequency();
+        if(frequency_file && frequency && frequency != last_frequency)
+            fprintf(frequency_file, "%lu %lu\n", time - start, frequency);
+        if(frequency)
+            last_frequency = frequency;
+    }
+    // A title still scrolling at the end counts up to the end
+    if(title_running && end - title_start > longest_title){
+        longest_title = end - title_start;
+        longest_title_time = title_start;
+    }
+    if(frequency_file){
+        // Hold the last frequency to the end, so pipeline_eval replays the full length
+        fprintf(frequency_file, "%lu %lu\n", end - start, last_frequency);
+        fclose(frequency_file);
+    }
+
+    double total_us = 0.0;
+    for(const Pass &pass : passes)
+        total_us += pass.us;
+    unsigned long register_writes = 0;
+    for(int i = 0; i < MD_AD9833::chip_count(); i++)
+        register_writes += MD_AD9833::chip(i)->register_writes();
+
+    printf("%s: %zu records over %.1f s%s\n", trace_path, records.size(),
+           (log.end_time() - log.start_time()) / 1000.0, log.truncated() ? " (truncated)" : "");
+    printf("  detents A %lu cw %lu ccw, B %lu cw %lu ccw; presses A %lu, B %lu; %lu records lost on the device\n",
+           kinds[INPUT_TRACE_CW], kinds[INPUT_TRACE_CCW], kinds[INPUT_TRACE_CW + 1], kinds[INPUT_TRACE_CCW + 1],
+           kinds[INPUT_TRACE_DOWN], kinds[INPUT_TRACE_DOWN + 1], lost);
+    printf("application switches: %lu of %lu as recorded", matched, switches);
+    if(first_mismatch)
+        printf(", first difference at %lu ms", first_mismatch);
+    printf("\nlongest titles after a switch: %lu ms at %lu ms%s\n", longest_title, longest_title_time,
+           title_limit && longest_title > title_limit ? " - over the limit" : "");
+    printf("input events dropped in replay: %u\n", input_events.dropped());
+    printf("AD9833 register writes: %lu, display I2C bytes: %lu\n", register_writes, Wire.bytes());
+    printf("loop passes: %zu, %.3f s on the host, %.2f us mean\n", passes.size(), total_us / 1e6,
+           passes.empty() ? 0.0 : total_us / passes.size());
+
+    size_t slowest = std::min((size_t)SLOWEST_PASSES, passes.size());
+    std::partial_sort(passes.begin(), passes.begin() + slowest, passes.end(),
+                      [](const Pass &a, const Pass &b){ return a.us > b.us; });
+    printf("slowest passes:");
+    for(size_t i = 0; i < slowest; i++)
+        printf(" %.1f us at %lu ms%s", passes[i].us, passes[i].time, i + 1 < slowest ? "," : "\n");
+
+    return switches == matched && (!title_limit || longest_title <= title_limit) ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <string.h>
+#include "input_trace_log.h"
+#include "input_trace.h"
+
+// One record at pos; false at the end of the data or on a malformed or cut-off record
+static bool decode_record(const std::vector<uint8_t> &data, size_t &pos, unsigned long time, InputTraceRecord &record)
+{
+    size_t next = pos;
+    if(next >= data.size())
+        return false;
+    uint8_t kind = data[next] >> 4;
+    unsigned long delta = data[next] & 0x0F;
+    next++;
+    if(kind > INPUT_TRACE_LOST)
+        return false;
+
+    if(delta == INPUT_TRACE_DELTA_ESCAPE){
+        delta = 0;
+        for(int shift = 0; ; shift += 7){
+            if(next >= data.size() || shift > 28)
+                return false;
+            uint8_t b = data[next++];
+            delta |= (unsigned long)(b & 0x7F) << shift;
+            if(!(b & 0x80))
+                break;
+        }
+    }
+
+    uint8_t value = 0;
+    if(kind >= INPUT_TRACE_APP){
+        if(next >= data.size())
+            return false;
+        value = data[next++];
+    }
+
+    record = {time + delta, kind, value};
+    pos = next;
+    return true;
+}
+
+bool InputTraceLog::load(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if(!file)
+        return false;
+    std::vector<uint8_t> data;
+    uint8_t buffer[4096];
+    size_t count;
+    while((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        data.insert(data.end(), buffer, buffer + count);
+    fclose(file);
+
+    const size_t magic_size = strlen(INPUT_TRACE_MAGIC);
+    size_t pos = 0;
+    while(pos + magic_size + 4 <= data.size() && memcmp(&data[pos], INPUT_TRACE_MAGIC, magic_size))
+        pos++;
+    if(pos + magic_size + 4 > data.size())
+        return false;
+    pos += magic_size;
+
+    _start_time = data[pos] | (data[pos + 1] << 8) | (data[pos + 2] << 16) | ((unsigned long)data[pos + 3] << 24);
+    pos += 4;
+
+    _records.clear();
+    unsigned long time = _start_time;
+    InputTraceRecord record;
+    while(decode_record(data, pos, time, record)){
+        time = record.time;
+        _records.push_back(record);
+    }
+    _truncated = pos < data.size();
+    return true;
+}
+
+const char *InputTraceLog::kind_name(uint8_t kind)
+{
+    static const char *const names[] = {
+        "cw A", "cw B", "ccw A", "ccw B", "down A", "down B", "up A", "up B", "app", "lost",
+    };
+    return kind <= INPUT_TRACE_LOST ? names[kind] : "?";
+}
@@ -0,0 +1,37 @@
+#ifndef __INPUT_TRACE_LOG_H__
+#define __INPUT_TRACE_LOG_H__
+
+#include <stdint.h>
+#include <vector>
+
+// Decoded input trace, as streamed by the firmware with ENABLE_INPUT_TRACE
+//
+// load() accepts a raw Serial capture: anything before the "FXT1" header is skipped,
+// and decoding stops at the first malformed record. One capture should hold one boot.
+
+struct InputTraceRecord
+{
+    unsigned long time;     // device millis()
+    uint8_t kind;           // INPUT_TRACE_*, encoder id included
+    uint8_t value;          // APP and LOST records
+};
+
+class InputTraceLog
+{
+public:
+    bool load(const char *path);
+
+    unsigned long start_time() const { return _start_time; }
+    unsigned long end_time() const { return _records.empty() ? _start_time : _records.back().time; }
+    const std::vector<InputTraceRecord> &records() const { return _records; }
+    bool truncated() const { return _truncated; }   // malformed or cut-off data at the end
+
+    static const char *kind_name(uint8_t kind);
+
+private:
+    unsigned long _start_time = 0;
+    std::vector<InputTraceRecord> _records;
+    bool _truncated = false;
+};
+
+#endif // __INPUT_TRACE_LOG_H__
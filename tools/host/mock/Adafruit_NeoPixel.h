@@ -0,0 +1,37 @@
+#ifndef __MOCK_ADAFRUIT_NEOPIXEL_H__
+#define __MOCK_ADAFRUIT_NEOPIXEL_H__
+
+#include <Arduino.h>
+
+// Host NeoPixel strip: keeps the pixel colors and counts show() calls
+
+#define NEO_GRB 0x52
+#define NEO_KHZ800 0x0000
+
+#define MOCK_NEOPIXEL_MAX 16
+
+class Adafruit_NeoPixel
+{
+public:
+    Adafruit_NeoPixel(uint16_t n = 0, int16_t pin = 6, uint16_t type = NEO_GRB + NEO_KHZ800)
+        : _count(n < MOCK_NEOPIXEL_MAX ? n : MOCK_NEOPIXEL_MAX) { clear(); }
+
+    void begin() {}
+    void show() { _shows++; }
+    void clear() { memset(_pixels, 0, sizeof(_pixels)); }
+    void setPixelColor(uint16_t n, uint32_t c) { if(n < _count) _pixels[n] = c; }
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) { setPixelColor(n, Color(r, g, b)); }
+    uint32_t getPixelColor(uint16_t n) const { return n < _count ? _pixels[n] : 0; }
+    uint16_t numPixels() const { return _count; }
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) { return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b; }
+
+    // Host tool helper
+    unsigned long shows() const { return _shows; }
+
+private:
+    uint16_t _count;
+    uint32_t _pixels[MOCK_NEOPIXEL_MAX];
+    unsigned long _shows = 0;
+};
+
+#endif // __MOCK_ADAFRUIT_NEOPIXEL_H__
@@ -0,0 +1,111 @@
+#ifndef __MOCK_ARDUINO_H__
+#define __MOCK_ARDUINO_H__
+
+// Minimal Arduino API for host (NATIVE_BUILD) tools
+// Time is virtual: see mock_arduino.cpp
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define PSTR(s) (s)
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper *)(s))
+// memcpy reads exactly the bytes avr-libc's lpm sequence would, whatever the pointee type
+static inline uint8_t mock_pgm_read_byte(const void *p){ uint8_t v; memcpy(&v, p, sizeof(v)); return v; }
+static inline uint16_t mock_pgm_read_word(const void *p){ uint16_t v; memcpy(&v, p, sizeof(v)); return v; }
+static inline uint32_t mock_pgm_read_dword(const void *p){ uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+#define pgm_read_byte(p) mock_pgm_read_byte(p)
+#define pgm_read_word(p) mock_pgm_read_word(p)
+#define pgm_read_dword(p) mock_pgm_read_dword(p)
+#define strcpy_P strcpy
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define LED_BUILTIN 13
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+
+template<class T, class U> inline auto min(T a, U b) -> decltype(a < b ? a : b) { return a < b ? a : b; }
+template<class T, class U> inline auto max(T a, U b) -> decltype(a > b ? a : b) { return a > b ? a : b; }
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Pins read back what was written; analog inputs read as noise
+// A pin hook sees every digitalWrite(), e.g. to decode bit-banged SPI
+void pinMode(uint8_t pin, uint8_t mode);
+void mock_set_pin_hook(void (*hook)(uint8_t pin, uint8_t val));
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+void attachInterrupt(uint8_t interrupt, void (*handler)(void), int mode);
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// Serial output goes to stdout when enabled with mock_serial_echo(true)
+class Print
+{
+public:
+    virtual size_t write(uint8_t c) = 0;
+    size_t write(const char *s) { size_t n = 0; while(*s) n += write((uint8_t)*s++); return n; }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n) { return print((long)n); }
+    size_t print(unsigned int n) { return print((unsigned long)n); }
+    size_t print(long n) { char buf[24]; snprintf(buf, sizeof(buf), "%ld", n); return write(buf); }
+    size_t print(unsigned long n) { char buf[24]; snprintf(buf, sizeof(buf), "%lu", n); return write(buf); }
+    size_t print(double n, int digits = 2) { char buf[40]; snprintf(buf, sizeof(buf), "%.*f", digits, n); return write(buf); }
+    size_t println() { return write((uint8_t)'\n'); }
+    template<class T> size_t println(T value) { size_t n = print(value); return n + println(); }
+};
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long baud) {}
+    int available() { return 0; }
+    int availableForWrite() { return 64; }
+    int read() { return -1; }
+    void flush() {}
+    operator bool() { return true; }
+    virtual size_t write(uint8_t c);
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+void mock_serial_echo(bool echo);
+
+// Virtual clock control for host tools
+void mock_set_micros(unsigned long us);
+void mock_advance_micros(unsigned long us);
+
+#endif // __MOCK_ARDUINO_H__
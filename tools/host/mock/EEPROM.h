@@ -0,0 +1,49 @@
+#ifndef __MOCK_EEPROM_H__
+#define __MOCK_EEPROM_H__
+
+// EEPROM for host (NATIVE_BUILD) tools
+// Erased contents are 0xFF. Reads and writes are counted so tools can report access cost.
+
+#include <Arduino.h>
+
+#define MOCK_EEPROM_SIZE 1024
+
+class EEPROMClass
+{
+public:
+    EEPROMClass() { erase(); }
+
+    uint8_t read(int idx) { _reads++; return _data[idx % MOCK_EEPROM_SIZE]; }
+    void write(int idx, uint8_t val) { _writes++; _data[idx % MOCK_EEPROM_SIZE] = val; }
+    void update(int idx, uint8_t val) { if(read(idx) != val) write(idx, val); }
+    uint16_t length() { return MOCK_EEPROM_SIZE; }
+
+    template<typename T> T &get(int idx, T &t) {
+        uint8_t *p = (uint8_t *)&t;
+        for(unsigned int i = 0; i < sizeof(T); i++)
+            p[i] = read(idx + i);
+        return t;
+    }
+
+    template<typename T> const T &put(int idx, const T &t) {
+        const uint8_t *p = (const uint8_t *)&t;
+        for(unsigned int i = 0; i < sizeof(T); i++)
+            update(idx + i, p[i]);
+        return t;
+    }
+
+    // Host tool helpers
+    void erase() { memset(_data, 0xFF, sizeof(_data)); }
+    unsigned long reads() const { return _reads; }
+    unsigned long writes() const { return _writes; }
+    void reset_counters() { _reads = 0; _writes = 0; }
+
+private:
+    uint8_t _data[MOCK_EEPROM_SIZE];
+    unsigned long _reads = 0;
+    unsigned long _writes = 0;
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // __MOCK_EEPROM_H__
@@ -0,0 +1,70 @@
+#ifndef __MOCK_MD_AD9833_H__
+#define __MOCK_MD_AD9833_H__
+
+#include <Arduino.h>
+
+#ifdef HOST_AD9833_SPI
+
+// Bit-exact builds use the bit-banged driver from lib/MD_AD9833_Custom. Its SPI pin
+// writes are decoded by tools/host/ad9833_emu into AD9833 emulators.
+#include "MD_AD9833_Minimal.h"
+
+#else
+
+// Host MD_AD9833: keeps the register image the firmware would have written
+//
+// Frequency words use the same truncating formula as lib/MD_AD9833_Custom
+// (FreqReg = f * 2^28 / MCLK), so host tools see the chip's real frequency resolution.
+// Every constructed chip is registered in order (AD1, AD2, ...) for the host tools.
+
+#define MOCK_AD9833_MCLK 25000000UL
+#define MOCK_AD9833_MAX_CHIPS 8
+
+class MD_AD9833
+{
+public:
+    enum channel_t
+    {
+        CHAN_0 = 0,
+        CHAN_1 = 1,
+    };
+
+    enum mode_t
+    {
+        MODE_OFF,
+        MODE_SINE,
+        MODE_SQUARE1,
+        MODE_SQUARE2,
+        MODE_TRIANGLE,
+    };
+
+    MD_AD9833(uint8_t dataPin, uint8_t clkPin, uint8_t fsyncPin);
+
+    void begin(void);
+    bool setFrequency(channel_t channel, float frequency);
+    bool setActiveFrequency(channel_t channel);
+    bool setMode(mode_t mode);
+
+    // Host tool helpers
+    uint32_t frequency_word(channel_t channel) const { return _regFreq[channel]; }
+    channel_t active_channel() const { return _active; }
+    uint32_t active_word() const { return _regFreq[_active]; }
+    bool is_reset() const { return _reset; }
+    unsigned long register_writes() const { return _writes; }   // 16-bit SPI words
+
+    static int chip_count() { return _chip_count; }
+    static MD_AD9833 *chip(int index) { return index < _chip_count ? _chips[index] : nullptr; }
+
+private:
+    uint32_t _regFreq[2];
+    channel_t _active;
+    bool _reset;
+    unsigned long _writes;
+
+    static MD_AD9833 *_chips[MOCK_AD9833_MAX_CHIPS];
+    static int _chip_count;
+};
+
+#endif // HOST_AD9833_SPI
+
+#endif // __MOCK_MD_AD9833_H__
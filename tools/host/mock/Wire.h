@@ -0,0 +1,39 @@
+#ifndef __MOCK_WIRE_H__
+#define __MOCK_WIRE_H__
+
+#include <Arduino.h>
+
+// Host TwoWire that counts I2C traffic instead of sending it
+//
+// A transaction is one beginTransmission()/endTransmission() pair. Bytes include the
+// address byte, so the bus cost of a transaction is roughly
+// (bytes * 9 bits + start/stop) at the configured clock.
+class TwoWire
+{
+public:
+    void begin() {}
+    void setClock(unsigned long clock) { _clock = clock; }
+
+    void beginTransmission(int address);
+    uint8_t endTransmission(bool stop = true);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t *data, size_t length);
+
+    void reset_counters();
+    unsigned long transactions() const { return _transactions; }
+    unsigned long bytes() const { return _bytes; }
+    unsigned long max_transaction_bytes() const { return _max_transaction_bytes; }
+    unsigned long bus_micros() const;   // Time the traffic would take on the wire
+
+private:
+    unsigned long _clock = 100000;
+    unsigned long _transactions = 0;
+    unsigned long _bytes = 0;
+    unsigned long _current_bytes = 0;
+    unsigned long _max_transaction_bytes = 0;
+    bool _in_transaction = false;
+};
+
+extern TwoWire Wire;
+
+#endif // __MOCK_WIRE_H__
@@ -0,0 +1,53 @@
+#include <MD_AD9833.h>
+
+#ifndef HOST_AD9833_SPI
+
+MD_AD9833 *MD_AD9833::_chips[MOCK_AD9833_MAX_CHIPS];
+int MD_AD9833::_chip_count = 0;
+
+MD_AD9833::MD_AD9833(uint8_t dataPin, uint8_t clkPin, uint8_t fsyncPin)
+{
+    _regFreq[0] = 0;
+    _regFreq[1] = 0;
+    _active = CHAN_0;
+    _reset = true;      // output held at midscale until begin()
+    _writes = 0;
+
+    if(_chip_count < MOCK_AD9833_MAX_CHIPS)
+        _chips[_chip_count++] = this;
+}
+
+void MD_AD9833::begin(void)
+{
+    // Reset, clear reset, both channels to 1 kHz, channel 0 selected
+    _writes += 2;
+    _reset = false;
+    setFrequency(CHAN_0, 1000.0);
+    setFrequency(CHAN_1, 1000.0);
+    setActiveFrequency(CHAN_0);
+}
+
+bool MD_AD9833::setFrequency(channel_t channel, float frequency)
+{
+    if(channel > CHAN_1)
+        return false;
+    _regFreq[channel] = (uint32_t)((frequency * 268435456.0) / MOCK_AD9833_MCLK) & 0x0FFFFFFF;
+    _writes += 2;   // 14 LSBs, then 14 MSBs
+    return true;
+}
+
+bool MD_AD9833::setActiveFrequency(channel_t channel)
+{
+    if(channel > CHAN_1)
+        return false;
+    _active = channel;
+    _writes++;      // control register
+    return true;
+}
+
+bool MD_AD9833::setMode(mode_t mode)
+{
+    return true;
+}
+
+#endif // HOST_AD9833_SPI
@@ -0,0 +1,116 @@
+#include <Arduino.h>
+
+// Virtual clock for host tools
+//
+// Nothing really waits: delay() advances the clock, and every millis()/micros() call
+// advances it by MOCK_TICK_MICROS so busy-wait loops such as
+// HT16K33Disp::scroll_string() always make progress.
+
+#define MOCK_TICK_MICROS 10
+
+static unsigned long mock_micros = 0;
+
+unsigned long micros()
+{
+    mock_micros += MOCK_TICK_MICROS;
+    return mock_micros;
+}
+
+unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+void delay(unsigned long ms)
+{
+    mock_micros += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    mock_micros += us;
+}
+
+void mock_set_micros(unsigned long us)
+{
+    mock_micros = us;
+}
+
+void mock_advance_micros(unsigned long us)
+{
+    mock_micros += us;
+}
+
+// Pins, interrupts and serial
+
+#define MOCK_PINS 32
+
+static uint8_t pin_levels[MOCK_PINS];
+static bool serial_echo = false;
+static void (*pin_hook)(uint8_t pin, uint8_t val) = nullptr;
+
+HardwareSerial Serial;
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if(mode == INPUT_PULLUP && pin < MOCK_PINS)
+        pin_levels[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    if(pin < MOCK_PINS)
+        pin_levels[pin] = val ? HIGH : LOW;
+    if(pin_hook)
+        pin_hook(pin, val ? HIGH : LOW);
+}
+
+void mock_set_pin_hook(void (*hook)(uint8_t pin, uint8_t val))
+{
+    pin_hook = hook;
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pin < MOCK_PINS ? pin_levels[pin] : LOW;
+}
+
+int analogRead(uint8_t pin)
+{
+    return rand() & 0x3FF;
+}
+
+void analogWrite(uint8_t pin, int val)
+{
+}
+
+void attachInterrupt(uint8_t interrupt, void (*handler)(void), int mode)
+{
+}
+
+long random(long howbig)
+{
+    return howbig > 0 ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig)
+{
+    return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+void randomSeed(unsigned long seed)
+{
+    srand(seed);
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if(serial_echo)
+        putchar(c);
+    return 1;
+}
+
+void mock_serial_echo(bool echo)
+{
+    serial_echo = echo;
+}
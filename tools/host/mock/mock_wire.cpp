@@ -0,0 +1,49 @@
+#include <Wire.h>
+
+TwoWire Wire;
+
+void TwoWire::beginTransmission(int address)
+{
+    _in_transaction = true;
+    _current_bytes = 1;     // address byte
+}
+
+uint8_t TwoWire::endTransmission(bool stop)
+{
+    if (_in_transaction) {
+        _transactions++;
+        _bytes += _current_bytes;
+        if (_current_bytes > _max_transaction_bytes)
+            _max_transaction_bytes = _current_bytes;
+    }
+    _in_transaction = false;
+    return 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+    if (_in_transaction)
+        _current_bytes++;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t length)
+{
+    if (_in_transaction)
+        _current_bytes += length;
+    return length;
+}
+
+void TwoWire::reset_counters()
+{
+    _transactions = 0;
+    _bytes = 0;
+    _max_transaction_bytes = 0;
+}
+
+unsigned long TwoWire::bus_micros() const
+{
+    // 9 clocks per byte (8 data + ACK) plus roughly 2 for start and stop
+    unsigned long clocks = _bytes * 9 + _transactions * 2;
+    return (unsigned long)((clocks * 1000000ULL) / _clock);
+}
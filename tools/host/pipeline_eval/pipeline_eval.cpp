@@ -0,0 +1,326 @@
+// Monte Carlo evaluator for StationManager pipelining policies
+//
+// Replays tuning traces through the host station simulation (tools/host/sim) once for
+// every combination of pipelining parameters, and reports per parameter set:
+//
+//   wait      time from the VFO coming to rest until a station holding generators is
+//             within the audible bounds (mean, median, 95th percentile)
+//   none      listening periods that end with no station found
+//   dead air  share of listening time with every AD9833 silent
+//   acq/min   generator acquisitions per minute (churn)
+//   fail/min  failed acquisitions per minute, and the worst single second (retry storms)
+//   moves/min stations relocated by reallocateStations()
+//
+// "Listening" is any stretch of at least 1 s with no VFO change. Every parameter set
+// sees the same traces and station seeds, so differences between rows come from the
+// policy alone. The simulation is global state, so each run is a fork()ed child of a
+// pristine process. Runs are spread over all cores and return results through shared
+// memory.
+//
+//   pio run -e host_pipeline_eval
+//   .pio/build/host_pipeline_eval/program -n 500 -lookahead 6000,8000,10000 -settle 2000,5000
+//
+// Options:
+//   -n traces         generated traces (default 200)
+//   -s seconds        length of generated traces (default 120)
+//   -trace file       replay a recorded "time_ms frequency_hz" trace instead (repeatable)
+//   -j jobs           parallel runs (default: online cores)
+//   -lookahead list   PIPELINE_LOOKAHEAD_RANGE values, comma separated
+//   -threshold list   PIPELINE_REALLOC_THRESHOLD values
+//   -interval list    PIPELINE_REALLOC_INTERVAL values (ms)
+//   -settle list      PIPELINE_SETTLE_TIME values (ms)
+
+#include <Arduino.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <vector>
+#include "station_sim.h"
+#include "tuning_trace.h"
+
+#ifndef ENABLE_PIPELINE_STATS
+#error "pipeline_eval needs ENABLE_PIPELINE_STATS (env host_pipeline_eval)"
+#endif
+
+#define DEFAULT_TRACES 200
+#define DEFAULT_SECONDS 120
+#define START_FREQUENCY 555123400UL
+#define WAIT_BIN_MS 100
+#define WAIT_BINS 200               // up to 20 s; longer waits land in the last bin
+
+struct RunResult
+{
+    uint32_t duration;              // ms
+    uint32_t listen_periods;
+    uint32_t listen_ms;
+    uint32_t dead_ms;
+    uint32_t no_station;            // listening periods with no station found
+    uint32_t wait_sum;              // ms, over periods with a station found
+    uint32_t wait_bins[WAIT_BINS];
+    uint32_t acquired;
+    uint32_t failed;
+    uint32_t worst_failed_second;
+    uint32_t moved;
+};
+
+static bool parse_list(const char *text, std::vector<uint16_t> &values)
+{
+    values.clear();
+    while(*text){
+        char *end;
+        unsigned long value = strtoul(text, &end, 0);
+        if(end == text || value > 65535)
+            return false;
+        values.push_back((uint16_t)value);
+        text = *end == ',' ? end + 1 : end;
+    }
+    return !values.empty();
+}
+
+// A station holds its generators and its tone is within the firmware's audible bounds
+static bool station_in_range()
+{
+    for(int i = 0; i < STATION_COUNT; i++){
+        SimDualTone *station = station_sim_stations[i].station;
+        float frequency = station->get_frequency_a();
+        if(station->has_all_realizers() && frequency >= MIN_AUDIBLE_FREQ && frequency <= MAX_AUDIBLE_FREQ)
+            return true;
+    }
+    return false;
+}
+
+// Any AD9833 producing an audible tone
+static bool chips_sounding()
+{
+    for(int i = 0; i < STATION_SIM_AD9833_COUNT; i++){
+        MD_AD9833 *chip = station_sim_ad9833[i];
+        double frequency = chip->active_word() * (double)MOCK_AD9833_MCLK / 268435456.0;
+        if(!chip->is_reset() && frequency >= 20.0 && frequency <= MAX_AUDIBLE_FREQ)
+            return true;
+    }
+    return false;
+}
+
+static void run(const TuningTrace &trace, uint32_t seed, const PipelineParams &params, RunResult &result)
+{
+    const std::vector<TracePoint> &points = trace.points();
+    std::vector<ListenPeriod> periods = trace.listen_periods();
+
+    station_manager.setPipelineParams(params);
+    station_sim_begin(seed, points[0].frequency);
+
+    // Count from the end of setup, so the boot allocation is not churn
+    unsigned long acquired_base = wave_gen_pool.get_acquired_count();
+    unsigned long failed_base = wave_gen_pool.get_failed_count();
+    unsigned long moved_base = station_manager.getStationsMoved();
+    unsigned long failed_second_base = failed_base;
+
+    size_t next_point = 1;
+    size_t period = 0;
+    bool found = false;
+    unsigned long duration = trace.duration();
+
+    for(unsigned long time = 0; time < duration; time++){
+        while(next_point < points.size() && points[next_point].time <= time)
+            station_sim_tune(points[next_point++].frequency);
+        station_sim_step(time);
+
+        while(period < periods.size() && periods[period].end <= time){
+            if(!found)
+                result.no_station++;
+            period++;
+            found = false;
+        }
+        if(period < periods.size() && time >= periods[period].start){
+            if(time == periods[period].start)
+                result.listen_periods++;
+            result.listen_ms++;
+            if(!chips_sounding())
+                result.dead_ms++;
+            if(!found && station_in_range()){
+                unsigned long wait = time - periods[period].start;
+                found = true;
+                result.wait_sum += wait;
+                result.wait_bins[wait / WAIT_BIN_MS < WAIT_BINS ? wait / WAIT_BIN_MS : WAIT_BINS - 1]++;
+            }
+        }
+
+        if(time % 1000 == 999){
+            unsigned long failed = wave_gen_pool.get_failed_count();
+            if(failed - failed_second_base > result.worst_failed_second)
+                result.worst_failed_second = failed - failed_second_base;
+            failed_second_base = failed;
+        }
+    }
+    if(period < periods.size() && !found)
+        result.no_station++;
+
+    result.duration = duration;
+    result.acquired = wave_gen_pool.get_acquired_count() - acquired_base;
+    result.failed = wave_gen_pool.get_failed_count() - failed_base;
+    result.moved = station_manager.getStationsMoved() - moved_base;
+}
+
+// Waiting time below which the given share of found stations fall
+static double wait_percentile(const uint32_t *bins, double share)
+{
+    unsigned long total = 0;
+    for(int i = 0; i < WAIT_BINS; i++)
+        total += bins[i];
+    if(!total)
+        return 0.0;
+    unsigned long target = (unsigned long)(share * total);
+    unsigned long seen = 0;
+    for(int i = 0; i < WAIT_BINS; i++){
+        seen += bins[i];
+        if(seen > target)
+            return (i + 1) * WAIT_BIN_MS / 1000.0;
+    }
+    return WAIT_BINS * WAIT_BIN_MS / 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+    int trace_count = DEFAULT_TRACES;
+    unsigned long seconds = DEFAULT_SECONDS;
+    long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    std::vector<const char *> trace_paths;
+    std::vector<uint16_t> lookahead = {PIPELINE_LOOKAHEAD_RANGE};
+    std::vector<uint16_t> threshold = {PIPELINE_REALLOC_THRESHOLD};
+    std::vector<uint16_t> interval = {PIPELINE_REALLOC_INTERVAL};
+    std::vector<uint16_t> settle = {PIPELINE_SETTLE_TIME};
+
+    for(int i = 1; i < argc; i++){
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[++i] : "";
+        bool ok = true;
+        if(!strcmp(arg, "-n"))
+            ok = (trace_count = atoi(value)) > 0;
+        else if(!strcmp(arg, "-s"))
+            ok = (seconds = strtoul(value, nullptr, 0)) > 0;
+        else if(!strcmp(arg, "-trace"))
+            trace_paths.push_back(value);
+        else if(!strcmp(arg, "-j"))
+            ok = (jobs = atol(value)) > 0;
+        else if(!strcmp(arg, "-lookahead"))
+            ok = parse_list(value, lookahead);
+        else if(!strcmp(arg, "-threshold"))
+            ok = parse_list(value, threshold);
+        else if(!strcmp(arg, "-interval"))
+            ok = parse_list(value, interval);
+        else if(!strcmp(arg, "-settle"))
+            ok = parse_list(value, settle);
+        else
+            ok = false;
+        if(!ok){
+            fprintf(stderr, "usage: %s [-n traces] [-s seconds] [-trace file]... [-j jobs]\n"
+                            "       [-lookahead list] [-threshold list] [-interval list] [-settle list]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<TuningTrace> traces;
+    if(!trace_paths.empty()){
+        for(const char *path : trace_paths){
+            traces.emplace_back();
+            if(!traces.back().load(path)){
+                fprintf(stderr, "cannot read trace %s\n", path);
+                return 1;
+            }
+        }
+    } else {
+        traces.resize(trace_count);
+        for(int t = 0; t < trace_count; t++)
+            traces[t].generate(t, seconds * 1000UL, START_FREQUENCY);
+    }
+
+    std::vector<PipelineParams> sets;
+    for(uint16_t l : lookahead)
+        for(uint16_t t : threshold)
+            for(uint16_t i : interval)
+                for(uint16_t s : settle)
+                    sets.push_back({l, t, i, s});
+
+    size_t runs = sets.size() * traces.size();
+    RunResult *results = (RunResult *)mmap(nullptr, runs * sizeof(RunResult), PROT_READ | PROT_WRITE,
+                                           MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(results == MAP_FAILED){
+        perror("mmap");
+        return 1;
+    }
+
+    auto started = std::chrono::steady_clock::now();
+
+    // Each child starts from the parent's untouched simulation state
+    size_t next = 0;
+    long running = 0;
+    int failures = 0;
+    while(next < runs || running){
+        while(running < jobs && next < runs){
+            pid_t pid = fork();
+            if(pid < 0){
+                perror("fork");
+                return 1;
+            }
+            if(pid == 0){
+                size_t trace = next % traces.size();
+                run(traces[trace], trace + 1, sets[next / traces.size()], results[next]);
+                _exit(0);
+            }
+            running++;
+            next++;
+        }
+        int status;
+        if(wait(&status) > 0){
+            running--;
+            if(!WIFEXITED(status) || WEXITSTATUS(status))
+                failures++;
+        }
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    printf("  lookahead threshold interval settle |  wait: mean   p50   p95  none | dead air | acq/min fail/min worst/s moves/min\n");
+    for(size_t s = 0; s < sets.size(); s++){
+        RunResult total = {};
+        for(size_t t = 0; t < traces.size(); t++){
+            const RunResult &result = results[s * traces.size() + t];
+            total.duration += result.duration / 1000;     // seconds, to stay in range
+            total.listen_periods += result.listen_periods;
+            total.listen_ms += result.listen_ms / 1000;   // seconds
+            total.dead_ms += result.dead_ms / 1000;
+            total.no_station += result.no_station;
+            total.wait_sum += result.wait_sum / 10;       // centiseconds
+            for(int i = 0; i < WAIT_BINS; i++)
+                total.wait_bins[i] += result.wait_bins[i];
+            total.acquired += result.acquired;
+            total.failed += result.failed;
+            total.moved += result.moved;
+            if(result.worst_failed_second > total.worst_failed_second)
+                total.worst_failed_second = result.worst_failed_second;
+        }
+
+        const PipelineParams &params = sets[s];
+        bool firmware = params.lookahead_range == PIPELINE_LOOKAHEAD_RANGE &&
+                        params.realloc_threshold == PIPELINE_REALLOC_THRESHOLD &&
+                        params.realloc_interval == PIPELINE_REALLOC_INTERVAL &&
+                        params.settle_time == PIPELINE_SETTLE_TIME;
+        unsigned long found = total.listen_periods - total.no_station;
+        double minutes = total.duration / 60.0;
+        printf("%c %9u %9u %8u %6u | %9.2f %5.1f %5.1f %4.1f%% | %7.1f%% | %7.1f %8.2f %7u %9.2f\n",
+               firmware ? '*' : ' ', params.lookahead_range, params.realloc_threshold, params.realloc_interval,
+               params.settle_time,
+               found ? total.wait_sum / 100.0 / found : 0.0,
+               wait_percentile(total.wait_bins, 0.5), wait_percentile(total.wait_bins, 0.95),
+               total.listen_periods ? 100.0 * total.no_station / total.listen_periods : 0.0,
+               total.listen_ms ? 100.0 * total.dead_ms / total.listen_ms : 0.0,
+               total.acquired / minutes, total.failed / minutes, total.worst_failed_second, total.moved / minutes);
+    }
+
+    printf("\n%zu parameter sets x %zu traces = %zu runs (%d failed) in %.1f s on %ld jobs, %.1f simulated hours\n",
+           sets.size(), traces.size(), runs, failures, elapsed, jobs,
+           runs * (double)traces[0].duration() / 3600000.0);
+    printf("* = firmware defaults in station_manager.h\n");
+    return failures ? 1 : 0;
+}
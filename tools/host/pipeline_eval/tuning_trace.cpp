@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include "tuning_trace.h"
+#include "fast_random.h"
+
+static const unsigned int tuning_rates[] = {500, 3000, 15000};   // Hz per second
+
+void TuningTrace::generate(uint32_t seed, unsigned long duration, unsigned long start_frequency)
+{
+    // Spread consecutive seeds apart and let xorshift mix before using it
+    FastRandom random((seed + 1UL) * 0x9E3779B9UL);
+    for(int i = 0; i < 8; i++)
+        random.next();
+    _points.clear();
+
+    unsigned long time = 0;
+    unsigned long frequency = start_frequency;
+    _points.push_back({0, frequency});
+
+    while(time < duration){
+        time += 2000 + random.below(13000);     // listen
+        if(time >= duration)
+            break;
+
+        unsigned int rate = tuning_rates[random.below(3)];
+        unsigned long burst_end = time + 300 + random.below(3700);
+        bool up = random.below(2);
+        unsigned long step = (rate * TRACE_FRAME_INTERVAL / 1000 + 50) / 100 * 100;   // Hz per frame
+        if(!step)
+            step = 100;
+
+        for(; time < burst_end && time < duration; time += TRACE_FRAME_INTERVAL){
+            frequency = up ? frequency + step : frequency - step;
+            _points.push_back({time, frequency});
+        }
+    }
+    _points.push_back({duration, frequency});
+}
+
+bool TuningTrace::load(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if(!file)
+        return false;
+
+    _points.clear();
+    char line[80];
+    while(fgets(line, sizeof(line), file)){
+        unsigned long time, frequency;
+        if(line[0] != '#' && sscanf(line, "%lu %lu", &time, &frequency) == 2)
+            _points.push_back({time, frequency});
+    }
+    fclose(file);
+    return !_points.empty();
+}
+
+std::vector<ListenPeriod> TuningTrace::listen_periods() const
+{
+    std::vector<ListenPeriod> periods;
+    for(size_t i = 0; i + 1 < _points.size(); i++){
+        unsigned long start = _points[i].time;
+        size_t j = i + 1;
+        while(j + 1 < _points.size() && _points[j].frequency == _points[i].frequency)
+            j++;
+        unsigned long end = _points[j].time;
+        if(end - start >= TRACE_LISTEN_MIN)
+            periods.push_back({start, end});
+        i = j - 1;
+    }
+    return periods;
+}
@@ -0,0 +1,47 @@
+#ifndef __TUNING_TRACE_H__
+#define __TUNING_TRACE_H__
+
+#include <stdint.h>
+#include <vector>
+
+// A VFO frequency over time, for driving the station simulation
+//
+// Traces are either generated or loaded from a text file with one "time_ms frequency_hz"
+// pair per line ('#' starts a comment). The frequency holds until the next point.
+//
+// Generated traces alternate listening (the VFO stays put for 2-15 s) with tuning
+// bursts of 0.3-4 s. A burst moves up or down at a slow (500 Hz/s), browsing (3 kHz/s)
+// or fast (15 kHz/s) rate, in 100 Hz steps applied once per 20 ms tuning frame.
+
+#define TRACE_FRAME_INTERVAL 20     // ms, as TUNING_FRAME_INTERVAL
+#define TRACE_LISTEN_MIN 1000       // ms the VFO must stay put to count as listening
+
+struct TracePoint
+{
+    unsigned long time;
+    unsigned long frequency;
+};
+
+struct ListenPeriod
+{
+    unsigned long start;
+    unsigned long end;
+};
+
+class TuningTrace
+{
+public:
+    void generate(uint32_t seed, unsigned long duration, unsigned long start_frequency);
+    bool load(const char *path);
+
+    unsigned long duration() const { return _points.empty() ? 0 : _points.back().time; }
+    const std::vector<TracePoint> &points() const { return _points; }
+
+    // Stretches of at least TRACE_LISTEN_MIN with no frequency change
+    std::vector<ListenPeriod> listen_periods() const;
+
+private:
+    std::vector<TracePoint> _points;
+};
+
+#endif // __TUNING_TRACE_H__
@@ -0,0 +1,117 @@
+#include "station_sim.h"
+#include "station_config.h"
+#include "wavegen.h"
+#include "wave_gen_pool.h"
+#include "sim_telco.h"
+#include "sim_dtmf.h"
+#include "fast_random.h"
+#include "static_realization_pool.h"
+
+// Objects mirror src/main.cpp
+
+const uint8_t station_sim_fsync_pins[STATION_SIM_AD9833_COUNT] = {8, 14, 15, 16};
+
+static MD_AD9833 AD1(STATION_SIM_DATA_PIN, STATION_SIM_CLK_PIN, 8);
+static MD_AD9833 AD2(STATION_SIM_DATA_PIN, STATION_SIM_CLK_PIN, 14);
+static MD_AD9833 AD3(STATION_SIM_DATA_PIN, STATION_SIM_CLK_PIN, 15);
+static MD_AD9833 AD4(STATION_SIM_DATA_PIN, STATION_SIM_CLK_PIN, 16);
+
+MD_AD9833 *const station_sim_ad9833[STATION_SIM_AD9833_COUNT] = {&AD1, &AD2, &AD3, &AD4};
+
+static WaveGen wavegen1(&AD1);
+static WaveGen wavegen2(&AD2);
+static WaveGen wavegen3(&AD3);
+static WaveGen wavegen4(&AD4);
+
+static WaveGen *wavegens[4] = {&wavegen1, &wavegen2, &wavegen3, &wavegen4};
+static bool realizer_stats[4] = {false, false, false, false};
+WaveGenPool wave_gen_pool(wavegens, realizer_stats, 4);
+
+SignalMeter signal_meter;
+
+#define DEFINE_TELCO_STATION(name, freq, type, boot) static SimTelco name(&wave_gen_pool, &signal_meter, freq, TelcoType::type);
+#define DEFINE_DTMF_STATION(name, freq, boot) static SimDTMF name(&wave_gen_pool, &signal_meter, freq);
+STATION_TABLE(DEFINE_TELCO_STATION, DEFINE_DTMF_STATION)
+
+#define LIST_STATION(name, ...) &name,
+static Realization *realizations[] = {
+    STATION_TABLE(LIST_STATION, LIST_STATION)
+};
+
+#define LIST_TELCO_ENTRY(name, ...) {#name, &name, &name, nullptr},
+#define LIST_DTMF_ENTRY(name, ...) {#name, &name, nullptr, &name},
+const StationSimStation station_sim_stations[STATION_COUNT] = {
+    STATION_TABLE(LIST_TELCO_ENTRY, LIST_DTMF_ENTRY)
+};
+
+#define BOOT_STATE_TELCO(name, freq, type, boot) boot,
+#define BOOT_STATE_DTMF(name, freq, boot) boot,
+static const StationState station_boot_states[] = {
+    STATION_TABLE(BOOT_STATE_TELCO, BOOT_STATE_DTMF)
+};
+
+static bool realization_stats[STATION_COUNT] = {};
+
+StationRealizationPool realization_pool(realizations, realization_stats, STATION_COUNT);
+
+StationManager station_manager(realizations, STATION_COUNT);
+
+VFO station_sim_vfo("EXC 555", 555123400L, 100, &realization_pool);
+
+static bool frame_pending = false;
+static unsigned long next_frame = 0;
+
+void station_sim_begin(uint32_t seed, unsigned long vfo_frequency, unsigned long time)
+{
+    mock_set_micros(time * 1000UL);
+    seed_fast_random(seed);
+    signal_meter.init();
+
+    for(int i = 0; i < STATION_SIM_AD9833_COUNT; i++){
+        MD_AD9833 *chip = station_sim_ad9833[i];
+        chip->begin();
+        chip->setFrequency((MD_AD9833::channel_t)0, 0.1);
+        chip->setFrequency((MD_AD9833::channel_t)1, 0.1);
+        chip->setMode(MD_AD9833::MODE_SINE);
+    }
+
+    station_sim_vfo._frequency = vfo_frequency;
+    station_manager.enableDynamicPipelining(true);
+    station_manager.setupPipeline(vfo_frequency);
+
+    for(int i = 0; i < STATION_COUNT; i++){
+        SimDualTone *station = station_manager.getStation(i);
+        station->seed_random(i + 1);
+        if(station_boot_states[i] != AUDIBLE)
+            continue;
+        station->begin(time + fast_random.below((i + 1) * 1000U));
+        station->set_station_state(AUDIBLE);
+    }
+
+    station_sim_vfo.update_realization();
+    frame_pending = false;
+    next_frame = time;
+}
+
+void station_sim_step(unsigned long time)
+{
+    mock_set_micros(time * 1000UL);
+
+    signal_meter.update(time);
+    station_manager.updateStations(station_sim_vfo._frequency);
+    realization_pool.step(time);
+
+    if(frame_pending && (long)(time - next_frame) >= 0){
+        station_sim_vfo.update_realization();
+        frame_pending = false;
+        next_frame = time + STATION_SIM_FRAME_INTERVAL;
+    }
+}
+
+void station_sim_tune(unsigned long vfo_frequency)
+{
+    if(vfo_frequency == station_sim_vfo._frequency)
+        return;
+    station_sim_vfo._frequency = vfo_frequency;
+    frame_pending = true;
+}
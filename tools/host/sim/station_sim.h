@@ -0,0 +1,58 @@
+#ifndef __STATION_SIM_H__
+#define __STATION_SIM_H__
+
+#include <Arduino.h>
+#include <MD_AD9833.h>
+#include "vfo.h"
+#include "signal_meter.h"
+#include "station_manager.h"
+#include "realization_pool.h"
+#include "wave_gen_pool.h"
+#include "station_config.h"
+
+class SimTelco;
+class SimDTMF;
+
+// Host copy of the firmware's station simulation
+//
+// Builds the same objects as src/main.cpp (four AD9833s behind the WaveGenPool, the
+// STATION_TABLE stations, RealizationPool, StationManager and one VFO) and runs the
+// SimTelco main loop on the virtual clock: signal meter, station manager and
+// realization pool, once per station_sim_step(). Display, encoders and settings are
+// not part of the host simulation.
+
+#define STATION_SIM_AD9833_COUNT 4
+#define STATION_SIM_FRAME_INTERVAL 20   // ms between tuning frames, as TUNING_FRAME_INTERVAL
+
+// AD9833 wiring, as in src/main.cpp: shared DATA and SCLK, one FSYNC per chip
+#define STATION_SIM_DATA_PIN 11
+#define STATION_SIM_CLK_PIN 13
+extern const uint8_t station_sim_fsync_pins[STATION_SIM_AD9833_COUNT];
+
+// One STATION_TABLE entry; exactly one of telco and dtmf is set
+struct StationSimStation
+{
+    const char *name;
+    SimDualTone *station;
+    SimTelco *telco;
+    SimDTMF *dtmf;
+};
+
+extern MD_AD9833 *const station_sim_ad9833[STATION_SIM_AD9833_COUNT];
+extern const StationSimStation station_sim_stations[STATION_COUNT];
+extern WaveGenPool wave_gen_pool;
+extern SignalMeter signal_meter;
+extern StationManager station_manager;
+extern StationRealizationPool realization_pool;
+extern VFO station_sim_vfo;
+
+// Seeds the random streams, resets the chips and starts every station as setup()/loop() do
+void station_sim_begin(uint32_t seed, unsigned long vfo_frequency, unsigned long time = 0);
+
+// One main loop pass at time (ms); sets the virtual clock to match
+void station_sim_step(unsigned long time);
+
+// Moves the VFO; the realization update is applied by the next frame, as in the firmware
+void station_sim_tune(unsigned long vfo_frequency);
+
+#endif // __STATION_SIM_H__
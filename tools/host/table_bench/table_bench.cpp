@@ -0,0 +1,147 @@
+// Lookup table storage benchmark for eeprom_tables
+//
+// Programs the Morse and Baudot tables into the counting EEPROM mock, then runs
+// text workloads through each storage scheme and prints EEPROM reads per lookup,
+// cache hit rate and RAM cost. Cache sizes are swept with TableCache directly;
+// the configured TABLE_STORAGE is also run through read_morse_table() and
+// read_baudot_table() and checked against the Flash tables.
+//
+//   pio run -e host_table_bench && .pio/build/host_table_bench/program
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "eeprom_tables.h"
+
+// Typical traffic: calls, reports and procedural words, sent repeatedly
+static const char *const workload_text[] = {
+    "CQ CQ CQ DE W1AW W1AW K",
+    "W1AW DE K6ABC UR RST 599 599 NAME BOB QTH SAN DIEGO CA HW CPY",
+    "R R TNX FER CALL BOB UR 579 QTH NEWINGTON CT 73 SK",
+    "RYRYRYRY THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789",
+};
+#define WORKLOAD_STRINGS (sizeof(workload_text) / sizeof(workload_text[0]))
+#define WORKLOAD_PASSES 50
+
+// Morse table index for a character, -1 if it has no entry
+static int morse_index(char c)
+{
+    if(c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if(c >= '0' && c <= '9')
+        return 26 + (c - '0');
+    return -1;
+}
+
+struct Result
+{
+    unsigned long lookups;
+    unsigned long hits;
+    unsigned long reads;
+    unsigned long mismatches;
+};
+
+// Runs the workload through lookup(morse, index) for every Morse and Baudot entry used
+template<typename Lookup>
+static Result run_workload(Lookup lookup)
+{
+    Result result = {0, 0, 0, 0};
+
+    EEPROM.reset_counters();
+    for(int pass = 0; pass < WORKLOAD_PASSES; pass++){
+        for(unsigned int s = 0; s < WORKLOAD_STRINGS; s++){
+            for(const char *p = workload_text[s]; *p; p++){
+                int index = morse_index(*p);
+                if(index >= 0){
+                    result.lookups++;
+                    if(lookup(true, index, result) != pgm_read_byte(morse_table_data + index))
+                        result.mismatches++;
+                }
+
+                index = *p & 0x7F;
+                result.lookups++;
+                if(lookup(false, index, result) != pgm_read_byte(baudot_table_data + index))
+                    result.mismatches++;
+            }
+        }
+    }
+    result.reads = EEPROM.reads();
+    return result;
+}
+
+static byte flash_lookup(bool morse, int index, Result &)
+{
+    return pgm_read_byte((morse ? morse_table_data : baudot_table_data) + index);
+}
+
+static byte eeprom_lookup(bool morse, int index, Result &)
+{
+    return morse ? eeprom_read_morse_data(index) : eeprom_read_baudot_data(index);
+}
+
+static byte configured_lookup(bool morse, int index, Result &)
+{
+    return morse ? read_morse_table(index) : read_baudot_table(index);
+}
+
+// A Morse and a Baudot cache of SIZE entries each in front of EEPROM
+template<byte SIZE>
+static Result run_cached()
+{
+    TableCache<SIZE> morse_cache;
+    TableCache<SIZE> baudot_cache;
+
+    return run_workload([&](bool morse, int index, Result &result) -> byte {
+        TableCache<SIZE> &cache = morse ? morse_cache : baudot_cache;
+        byte value;
+        if(cache.get(index, value)){
+            result.hits++;
+            return value;
+        }
+        value = eeprom_lookup(morse, index, result);
+        cache.put(index, value);
+        return value;
+    });
+}
+
+static void report(const char *name, unsigned int ram, const Result &result)
+{
+    printf("%-20s %4u bytes RAM %6lu lookups %6lu EEPROM reads %6.3f reads/lookup %5.1f%% hits%s\n",
+           name, ram, result.lookups, result.reads,
+           (double)result.reads / result.lookups, 100.0 * result.hits / result.lookups,
+           result.mismatches ? "  MISMATCH" : "");
+}
+
+int main()
+{
+    program_morse_table_to_eeprom();
+    program_baudot_table_to_eeprom();
+
+    EEPROM.reset_counters();
+    bool valid = eeprom_tables_valid();
+    printf("Table check: %s, %lu EEPROM reads (once per boot)\n\n", valid ? "valid" : "INVALID", EEPROM.reads());
+
+    // RAM is two caches of SIZE tags and SIZE values
+    report("Flash (PROGMEM)", 0, run_workload(flash_lookup));
+    report("EEPROM", 0, run_workload(eeprom_lookup));
+    report("EEPROM + cache 2", 2 * 2 * 2, run_cached<2>());
+    report("EEPROM + cache 4", 2 * 2 * 4, run_cached<4>());
+    report("EEPROM + cache 8", 2 * 2 * 8, run_cached<8>());
+    report("EEPROM + cache 16", 2 * 2 * 16, run_cached<16>());
+    report("EEPROM + cache 32", 2 * 2 * 32, run_cached<32>());
+    report("EEPROM + cache 64", 2 * 2 * 64, run_cached<64>());
+
+    printf("\nConfigured TABLE_STORAGE %d, TABLE_CACHE_SIZE %d:\n", TABLE_STORAGE, TABLE_CACHE_SIZE);
+    Result configured = run_workload(configured_lookup);
+#if TABLE_STORAGE == TABLE_STORAGE_EEPROM_CACHED
+    configured.hits = configured.lookups - configured.reads;   // every miss is one read
+    report("read_*_table()", 2 * 2 * TABLE_CACHE_SIZE, configured);
+#else
+    report("read_*_table()", 0, configured);
+#endif
+
+    // Reprogramming resets the once-per-boot check; a corrupted byte must then fail it
+    program_morse_table_to_eeprom();
+    EEPROM.write(EEPROM_BAUDOT_TABLE_ADDR + 'A', 0x00);
+    printf("\nCorrupted table check: %s\n", eeprom_tables_valid() ? "valid (WRONG)" : "invalid");
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Decodes telemetry captured from the firmware's Serial port (ENABLE_TELEMETRY)
+//
+// Prints one line per record, or with -s only the totals: records by kind, generator
+// grants, denials and station moves by station, and records lost on the device. Bytes
+// outside records (boot text, profiler output, a capture started mid-record) are
+// skipped.
+//
+//   stty -F /dev/ttyACM0 115200 raw && cat /dev/ttyACM0 > capture.bin
+//   pio run -e host_telemetry_decode
+//   .pio/build/host_telemetry_decode/program capture.bin
+//
+// Options:
+//   -s    summary only
+//   -     read standard input
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <map>
+#include "telemetry.h"
+#include "station_state.h"
+
+struct Record
+{
+    uint8_t id;
+    uint8_t arg;
+    unsigned long time;
+    unsigned long value;
+};
+
+static const char *const record_names[TELEMETRY_ID_COUNT] = {
+    "boot", "pool", "station", "state", "grant", "deny", "free", "tuning", "realloc", "move", "vfo", "lost",
+    "ram",
+};
+
+static const char *state_name(unsigned long state)
+{
+    switch(state){
+        case DORMANT: return "DORMANT";
+        case ACTIVE: return "ACTIVE";
+        case AUDIBLE: return "AUDIBLE";
+        case SILENT: return "SILENT";
+    }
+    return "?";
+}
+
+static void print_record(const Record &r)
+{
+    printf("%10.3f  %-8s", r.time / 1000.0, record_names[r.id]);
+    switch(r.id){
+        case TELEMETRY_BOOT:
+            printf("version %lu", r.value);
+            break;
+        case TELEMETRY_POOL:
+            printf("%u of %lu stations valid%s", r.arg, r.value, r.arg != r.value ? " - CRITICAL" : "");
+            break;
+        case TELEMETRY_STATION:
+            printf("S%u at %lu Hz", r.arg, r.value);
+            break;
+        case TELEMETRY_STATE:
+            printf("S%u %s", r.arg, state_name(r.value));
+            break;
+        case TELEMETRY_GRANT:
+            printf("S%u gets generator %lu", r.arg, r.value);
+            break;
+        case TELEMETRY_DENY:
+            printf("S%u: all generators in use", r.arg);
+            break;
+        case TELEMETRY_FREE:
+            printf("S%u frees generator %lu", r.arg, r.value);
+            break;
+        case TELEMETRY_TUNING:
+            printf("%s at %lu Hz", r.arg == TELEMETRY_TUNING_UP ? "up" : r.arg == TELEMETRY_TUNING_DOWN ? "down" : "paused",
+                   r.value);
+            break;
+        case TELEMETRY_REALLOC:
+            printf("%u stations to move, VFO %lu Hz", r.arg, r.value);
+            break;
+        case TELEMETRY_MOVE:
+            printf("S%u to %lu Hz", r.arg, r.value);
+            break;
+        case TELEMETRY_VFO:
+            printf("%lu Hz", r.value);
+            break;
+        case TELEMETRY_LOST:
+            printf("%lu records dropped (ring full)", r.value);
+            break;
+        case TELEMETRY_RAM:
+            printf("%s %lu bytes", r.arg == TELEMETRY_RAM_STATIC ? "static" : "stack free min", r.value);
+            break;
+    }
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    bool summary = false;
+    const char *path = nullptr;
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "-s"))
+            summary = true;
+        else if(!path)
+            path = argv[i];
+    }
+    if(!path){
+        fprintf(stderr, "usage: %s [-s] capture.bin|-\n", argv[0]);
+        return 1;
+    }
+    FILE *file = strcmp(path, "-") ? fopen(path, "rb") : stdin;
+    if(!file){
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+
+    unsigned long counts[TELEMETRY_ID_COUNT] = {};
+    std::map<int, unsigned long> grants, denials, moves;
+    unsigned long records = 0, skipped = 0, lost = 0;
+    unsigned long first_time = 0, last_time = 0;
+    unsigned long stack_free_min = 0;
+    bool have_stack = false;
+
+    uint8_t bytes[TELEMETRY_RECORD_SIZE];
+    int have = 0;
+    int c;
+    while((c = fgetc(file)) != EOF){
+        if(c & 0x80){
+            // a new record starts; anything collected so far was incomplete
+            skipped += have;
+            bytes[0] = c;
+            have = 1;
+            continue;
+        }
+        if(!have){
+            skipped++;
+            continue;
+        }
+        bytes[have++] = c;
+        if(have < TELEMETRY_RECORD_SIZE)
+            continue;
+        have = 0;
+
+        Record r = {(uint8_t)(bytes[0] & 0x7F), bytes[1], 0, 0};
+        for(int i = 3; i >= 0; i--)
+            r.time = (r.time << 7) | bytes[2 + i];
+        for(int i = 4; i >= 0; i--)
+            r.value = (r.value << 7) | bytes[6 + i];
+        if(r.id >= TELEMETRY_ID_COUNT){
+            skipped += TELEMETRY_RECORD_SIZE;
+            continue;
+        }
+
+        if(!records++)
+            first_time = r.time;
+        last_time = r.time;
+        counts[r.id]++;
+        if(r.id == TELEMETRY_GRANT)
+            grants[r.arg]++;
+        else if(r.id == TELEMETRY_DENY)
+            denials[r.arg]++;
+        else if(r.id == TELEMETRY_MOVE)
+            moves[r.arg]++;
+        else if(r.id == TELEMETRY_LOST)
+            lost += r.value;
+        else if(r.id == TELEMETRY_RAM && r.arg == TELEMETRY_RAM_STACK && (!have_stack || r.value < stack_free_min)){
+            stack_free_min = r.value;
+            have_stack = true;
+        }
+        if(!summary)
+            print_record(r);
+    }
+    skipped += have;
+    if(file != stdin)
+        fclose(file);
+
+    if(summary){
+        printf("%lu records over %.1f s, %lu lost on the device, %lu other bytes skipped\n",
+               records, (last_time - first_time) / 1000.0, lost, skipped);
+        for(int id = 0; id < TELEMETRY_ID_COUNT; id++){
+            if(counts[id])
+                printf("  %-8s %lu\n", record_names[id], counts[id]);
+        }
+        if(have_stack)
+            printf("least free stack %lu bytes\n", stack_free_min);
+        printf("station  grants  denials  moves\n");
+        std::map<int, bool> stations;
+        for(auto &g : grants) stations[g.first] = true;
+        for(auto &d : denials) stations[d.first] = true;
+        for(auto &m : moves) stations[m.first] = true;
+        for(auto &s : stations)
+            printf("  S%-5d %6lu %8lu %6lu\n", s.first, grants[s.first], denials[s.first], moves[s.first]);
+    }
+    return 0;
+}
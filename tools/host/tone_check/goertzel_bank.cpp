@@ -0,0 +1,49 @@
+#include <math.h>
+#include "goertzel_bank.h"
+#include "sim_dtmf.h"
+
+// Mean square below which a window counts as silence (-40 dBFS)
+#define SILENCE_FLOOR 1.0e-4f
+
+static const float lane_frequencies[GOERTZEL_TONES] = {
+    DTMF_ROW_1, DTMF_ROW_2, DTMF_ROW_3, DTMF_ROW_4,
+    DTMF_COL_1, DTMF_COL_2, DTMF_COL_3, DTMF_COL_4,
+    350.0f, 440.0f, 480.0f, 620.0f,     // dial tone, ringback, busy/reorder (telco_types.h)
+};
+
+GoertzelBank::GoertzelBank(unsigned long sample_rate)
+{
+    for(int k = 0; k < GOERTZEL_LANES; k++)
+        _coeff[k] = k < GOERTZEL_TONES ? (float)(2.0 * cos(2.0 * M_PI * lane_frequencies[k] / sample_rate)) : 0.0f;
+}
+
+float GoertzelBank::frequency(int lane)
+{
+    return lane < GOERTZEL_TONES ? lane_frequencies[lane] : 0.0f;
+}
+
+bool GoertzelBank::analyze(const float *x, int count, float *power) const
+{
+    float s1[GOERTZEL_LANES] = {};
+    float s2[GOERTZEL_LANES] = {};
+    float energy = 0.0f;
+
+    for(int n = 0; n < count; n++){
+        float in = x[n];
+        energy += in * in;
+        for(int k = 0; k < GOERTZEL_LANES; k++){
+            float s0 = in + _coeff[k] * s1[k] - s2[k];
+            s2[k] = s1[k];
+            s1[k] = s0;
+        }
+    }
+
+    if(energy < SILENCE_FLOOR * count)
+        return false;
+
+    // |X|^2 for a sine of amplitude A is (A * count / 2)^2 and the energy is A^2 * count / 2
+    float scale = 2.0f / (energy * count);
+    for(int k = 0; k < GOERTZEL_LANES; k++)
+        power[k] = (s1[k] * s1[k] + s2[k] * s2[k] - _coeff[k] * s1[k] * s2[k]) * scale;
+    return true;
+}
@@ -0,0 +1,34 @@
+#ifndef __GOERTZEL_BANK_H__
+#define __GOERTZEL_BANK_H__
+
+// Goertzel filters for every tone the stations send, run side by side
+//
+// The 16 lanes (8 DTMF, 4 telco and 4 unused) are stored as arrays and updated together
+// for each input sample, so the per-sample loop is a fixed 16-wide multiply-add that
+// the compiler turns into vector instructions. Lane powers are normalized by the
+// window energy: a single sine exactly at a lane frequency reads 1.0, each tone of an
+// equal pair 0.5.
+
+#define GOERTZEL_LANES 16
+
+// Lane layout
+#define GOERTZEL_ROW_LANE 0         // 697, 770, 852, 941 Hz
+#define GOERTZEL_COL_LANE 4         // 1209, 1336, 1477, 1633 Hz
+#define GOERTZEL_TELCO_LANE 8       // 350, 440, 480, 620 Hz
+#define GOERTZEL_TONES 12
+
+class GoertzelBank
+{
+public:
+    explicit GoertzelBank(unsigned long sample_rate);
+
+    // Relative power of each lane over x[0..count); false if the window is near silent
+    bool analyze(const float *x, int count, float *power) const;
+
+    static float frequency(int lane);
+
+private:
+    float _coeff[GOERTZEL_LANES];
+};
+
+#endif // __GOERTZEL_BANK_H__
@@ -0,0 +1,669 @@
+// Tone conformance checker for rendered station audio
+//
+// Reads renders from tools/host/audio_render together with their intent logs
+// (render.wav with render.intent). It runs a Goertzel bank over each render (20 ms
+// windows every 5 ms) and extracts the DTMF digits and telco tone pairs that are
+// actually heard, with their on and off times. Then it checks them against what the
+// stations meant to send:
+//
+// - every intended tone at its nominal audio frequency (station tuned to zero offset)
+//   must be heard with the same digit or pair, starting and ending within the
+//   tolerance. Tones that overlap another audible station are counted as masked and
+//   skipped, tones the VFO puts elsewhere are counted as off tune, and tones cut off
+//   by the end of the render are ignored.
+// - nothing may be heard where no station was sending
+// - each DTMF number heard in full must match the SimDTMF::_generated_number it was
+//   dialled from
+//
+// It then prints the intended and measured on and off times for each tone class,
+// next to the configured limits in async_dtmf.h and async_telco.h. Files are
+// checked in parallel, one per thread.
+//
+//   pio run -e host_tone_check
+//   .pio/build/host_tone_check/program [-j threads] [-t tolerance_ms] [-v] runs/*.wav
+//
+// Exits with 1 when any file fails.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "goertzel_bank.h"
+#include "async_dtmf.h"
+#include "async_telco.h"
+#include "sim_dualtone.h"
+
+#define WINDOW_MS 20
+#define HOP_MS 5
+#define DEFAULT_TOLERANCE_MS 10
+#define TONE_THRESHOLD 0.25f        // each tone of a pair, half its full-window power
+#define PAIR_THRESHOLD 0.5f         // both tones together
+#define MIN_SEGMENT_HOPS 2          // shorter detections are noise
+#define HIGHPASS_HZ 200.0           // below the lowest tone (350 Hz)
+#define MIN_AUDIBLE_HZ 20.0f
+#define CYCLE_GAP_MS 1500           // a longer pause ends a DTMF number (DTMF_SEQUENCE_GAP is 3 s)
+#define MAX_REPORTED_ERRORS 10
+
+static const char dtmf_keys[4][5] = {"123A", "456B", "789C", "*0#D"};
+
+struct TelcoPair
+{
+    char label;
+    int lane_a;
+    int lane_c;
+};
+
+static const TelcoPair telco_pairs[] = {
+    {'d', GOERTZEL_TELCO_LANE + 0, GOERTZEL_TELCO_LANE + 1},   // dial tone 350 + 440 Hz
+    {'r', GOERTZEL_TELCO_LANE + 1, GOERTZEL_TELCO_LANE + 2},   // ringback 440 + 480 Hz
+    {'b', GOERTZEL_TELCO_LANE + 2, GOERTZEL_TELCO_LANE + 3},   // busy and reorder 480 + 620 Hz
+};
+#define TELCO_PAIRS (sizeof(telco_pairs) / sizeof(telco_pairs[0]))
+
+// Tone classes for the cadence report
+enum ToneClass { CLASS_DTMF, CLASS_RINGBACK, CLASS_BUSY, CLASS_REORDER, CLASS_DIALTONE, CLASS_COUNT };
+static const char *const class_names[CLASS_COUNT] = {"DTMF", "RINGBACK", "BUSY", "REORDER", "DIALTONE"};
+
+// Configured on and off limits in ms (off is not configured as one range for DTMF)
+static const long class_limits[CLASS_COUNT][4] = {
+    {DTMF_TONE_MIN_DURATION, DTMF_TONE_MAX_DURATION, -1, -1},
+    {RINGBACK_TONE_A_DURATION, RINGBACK_TONE_A_DURATION, RINGBACK_SILENCE_MIN, RINGBACK_SILENCE_MAX},
+    {BUSY_TONE_A_DURATION, BUSY_TONE_A_DURATION, BUSY_SILENCE_MIN, BUSY_SILENCE_MAX},
+    {REORDER_TONE_A_DURATION, REORDER_TONE_A_DURATION, REORDER_SILENCE_MIN, REORDER_SILENCE_MAX},
+    {DIALTONE_TONE_A_DURATION, DIALTONE_TONE_A_DURATION, DIALTONE_SILENCE_MIN, DIALTONE_SILENCE_MAX},
+};
+
+struct Range
+{
+    long count = 0;
+    double min = 0.0;
+    double max = 0.0;
+
+    void add(double value)
+    {
+        min = count ? std::min(min, value) : value;
+        max = count ? std::max(max, value) : value;
+        count++;
+    }
+
+    void merge(const Range &other)
+    {
+        if(!other.count)
+            return;
+        min = count ? std::min(min, other.min) : other.min;
+        max = count ? std::max(max, other.max) : other.max;
+        count += other.count;
+    }
+};
+
+struct Cadence
+{
+    Range on_intended, on_measured, off_intended, off_measured;
+};
+
+struct Segment
+{
+    char label;
+    double start;
+    double end;
+    bool matched;
+};
+
+struct IntentTone
+{
+    int station;
+    double start;
+    double end;
+    char label;
+    ToneClass tone_class;
+    float freq_a;
+    float freq_c;
+    bool audible;
+    bool checked;
+    int match;      // detected segment, -1 if none
+};
+
+struct IntentNumber
+{
+    int station;
+    long time;
+    std::string digits;
+};
+
+struct FileResult
+{
+    std::string path;
+    std::string error;          // file could not be checked
+    long checked = 0;
+    long masked = 0;
+    long off_tune = 0;
+    long missed = 0;
+    long timing = 0;
+    long unexpected = 0;
+    long numbers_heard = 0;
+    long numbers_partial = 0;
+    long sequence_errors = 0;
+    std::vector<std::string> messages;
+    Cadence cadence[CLASS_COUNT];
+
+    bool failed() const { return !error.empty() || missed || timing || unexpected || sequence_errors; }
+
+    void message(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+void FileResult::message(const char *format, ...)
+{
+    if(messages.size() >= MAX_REPORTED_ERRORS)
+        return;
+    char text[160];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    messages.push_back(text);
+}
+
+// 16-bit mono PCM WAV, as written by audio_render
+static bool read_wav(const char *path, std::vector<float> &samples, unsigned long &sample_rate)
+{
+    FILE *file = fopen(path, "rb");
+    if(!file)
+        return false;
+
+    unsigned char header[12];
+    bool ok = fread(header, 1, 12, file) == 12 && !memcmp(header, "RIFF", 4) && !memcmp(header + 8, "WAVE", 4);
+    bool format_ok = false;
+    while(ok){
+        unsigned char chunk[8];
+        if(fread(chunk, 1, 8, file) != 8){
+            ok = false;
+            break;
+        }
+        uint32_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+        if(!memcmp(chunk, "fmt ", 4)){
+            unsigned char fmt[16];
+            ok = size >= 16 && fread(fmt, 1, 16, file) == 16;
+            format_ok = ok && fmt[0] == 1 && fmt[2] == 1 && fmt[14] == 16;  // PCM, mono, 16 bit
+            sample_rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((unsigned long)fmt[7] << 24);
+            fseek(file, size - 16 + (size & 1), SEEK_CUR);
+        } else if(!memcmp(chunk, "data", 4)){
+            ok = format_ok;
+            if(ok){
+                std::vector<int16_t> pcm(size / 2);
+                ok = fread(pcm.data(), 2, pcm.size(), file) == pcm.size();
+                samples.resize(pcm.size());
+                for(size_t n = 0; n < pcm.size(); n++)
+                    samples[n] = pcm[n] / 32768.0f;
+            }
+            break;
+        } else {
+            fseek(file, size + (size & 1), SEEK_CUR);
+        }
+    }
+    fclose(file);
+    return ok;
+}
+
+// Label heard in one window: a DTMF digit, a telco pair letter or 0
+static char classify(const float *power)
+{
+    int row = GOERTZEL_ROW_LANE;
+    int col = GOERTZEL_COL_LANE;
+    for(int k = 1; k < 4; k++){
+        if(power[GOERTZEL_ROW_LANE + k] > power[row])
+            row = GOERTZEL_ROW_LANE + k;
+        if(power[GOERTZEL_COL_LANE + k] > power[col])
+            col = GOERTZEL_COL_LANE + k;
+    }
+    if(power[row] > TONE_THRESHOLD && power[col] > TONE_THRESHOLD && power[row] + power[col] > PAIR_THRESHOLD)
+        return dtmf_keys[row - GOERTZEL_ROW_LANE][col - GOERTZEL_COL_LANE];
+
+    char label = 0;
+    float best = PAIR_THRESHOLD;
+    for(unsigned int i = 0; i < TELCO_PAIRS; i++){
+        float a = power[telco_pairs[i].lane_a];
+        float c = power[telco_pairs[i].lane_c];
+        if(a > TONE_THRESHOLD && c > TONE_THRESHOLD && a + c > best){
+            best = a + c;
+            label = telco_pairs[i].label;
+        }
+    }
+    return label;
+}
+
+// Second-order Butterworth high-pass, in place. Idle generators sit at SILENT_FREQ
+// (0.1 Hz) and the output coupling turns each switch to a tone into a slow step. Left
+// in, that step dominates the window energy and delays every detected start.
+static void highpass(std::vector<float> &samples, unsigned long sample_rate)
+{
+    double w = 2.0 * M_PI * HIGHPASS_HZ / sample_rate;
+    double alpha = sin(w) / (2.0 * M_SQRT1_2);
+    double a0 = 1.0 + alpha;
+    float b0 = (float)((1.0 + cos(w)) / 2.0 / a0);
+    float b1 = -2.0f * b0;
+    float a1 = (float)(-2.0 * cos(w) / a0);
+    float a2 = (float)((1.0 - alpha) / a0);
+
+    float x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f;
+    for(float &sample : samples){
+        float y = b0 * sample + b1 * x1 + b0 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1;
+        x1 = sample;
+        y2 = y1;
+        y1 = y;
+        sample = y;
+    }
+}
+
+// Tone segments heard in the render, times in ms
+static std::vector<Segment> detect(std::vector<float> &samples, unsigned long sample_rate)
+{
+    GoertzelBank bank(sample_rate);
+    highpass(samples, sample_rate);
+    int window = (int)(sample_rate * WINDOW_MS / 1000);
+    int hop = (int)(sample_rate * HOP_MS / 1000);
+
+    std::vector<char> labels;
+    float power[GOERTZEL_LANES];
+    for(size_t start = 0; start + window <= samples.size(); start += hop)
+        labels.push_back(bank.analyze(&samples[start], window, power) ? classify(power) : 0);
+
+    // Bridge single-window dropouts inside a tone
+    for(size_t i = 1; i + 1 < labels.size(); i++){
+        if(labels[i - 1] && labels[i - 1] == labels[i + 1] && labels[i] != labels[i - 1])
+            labels[i] = labels[i - 1];
+    }
+
+    // A window is labelled once the tone covers half of it, so an edge lies within half
+    // a hop of the first or last labelled window's centre
+    std::vector<Segment> segments;
+    const double hop_ms = 1000.0 * hop / sample_rate;
+    const double centre_ms = 500.0 * window / sample_rate;
+    for(size_t i = 0; i < labels.size();){
+        size_t j = i;
+        while(j < labels.size() && labels[j] == labels[i])
+            j++;
+        if(labels[i] && j - i >= MIN_SEGMENT_HOPS){
+            Segment segment;
+            segment.label = labels[i];
+            segment.start = i * hop_ms + centre_ms - hop_ms / 2;
+            segment.end = (j - 1) * hop_ms + centre_ms + hop_ms / 2;
+            segment.matched = false;
+            segments.push_back(segment);
+        }
+        i = j;
+    }
+    return segments;
+}
+
+// Nominal audio frequencies of a label; false for an unknown label
+static bool nominal_frequencies(char label, float &freq_a, float &freq_c)
+{
+    for(int row = 0; row < 4; row++){
+        const char *key = strchr(dtmf_keys[row], label);
+        if(key){
+            freq_a = GoertzelBank::frequency(GOERTZEL_ROW_LANE + row);
+            freq_c = GoertzelBank::frequency(GOERTZEL_COL_LANE + (int)(key - dtmf_keys[row]));
+            return true;
+        }
+    }
+    for(unsigned int i = 0; i < TELCO_PAIRS; i++){
+        if(telco_pairs[i].label == label){
+            freq_a = GoertzelBank::frequency(telco_pairs[i].lane_a);
+            freq_c = GoertzelBank::frequency(telco_pairs[i].lane_c);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool audible(float frequency)
+{
+    return fabsf(frequency) >= MIN_AUDIBLE_HZ && fabsf(frequency) <= MAX_AUDIBLE_FREQ;
+}
+
+static bool read_intent(const char *path, std::vector<IntentTone> &tones, std::vector<IntentNumber> &numbers)
+{
+    FILE *file = fopen(path, "r");
+    if(!file)
+        return false;
+
+    char line[160];
+    while(fgets(line, sizeof(line), file)){
+        IntentTone tone;
+        char label[16];
+        char digits[16];
+        long start, end, time;
+        int station;
+        if(sscanf(line, "tone %d %ld %ld %15s %f %f", &station, &start, &end, label, &tone.freq_a, &tone.freq_c) == 6){
+            tone.station = station;
+            tone.start = start;
+            tone.end = end;
+            if(label[1] == '\0'){
+                tone.label = label[0];
+                tone.tone_class = CLASS_DTMF;
+            } else if(!strcmp(label, "RINGBACK")){
+                tone.label = 'r';
+                tone.tone_class = CLASS_RINGBACK;
+            } else if(!strcmp(label, "BUSY") || !strcmp(label, "REORDER")){
+                tone.label = 'b';
+                tone.tone_class = label[0] == 'B' ? CLASS_BUSY : CLASS_REORDER;
+            } else {
+                tone.label = 'd';
+                tone.tone_class = CLASS_DIALTONE;
+            }
+            tone.audible = audible(tone.freq_a) || audible(tone.freq_c);
+            tone.checked = false;
+            tone.match = -1;
+            tones.push_back(tone);
+        } else if(sscanf(line, "number %d %ld %15s", &station, &time, digits) == 3){
+            numbers.push_back({station, time, digits});
+        }
+    }
+    fclose(file);
+
+    std::sort(tones.begin(), tones.end(), [](const IntentTone &a, const IntentTone &b) { return a.start < b.start; });
+    return true;
+}
+
+static std::string intent_path_for(const std::string &wav_path)
+{
+    size_t dot = wav_path.rfind('.');
+    size_t slash = wav_path.rfind('/');
+    if(dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        return wav_path + ".intent";
+    return wav_path.substr(0, dot) + ".intent";
+}
+
+// Checks intended tones against the segments heard and records the cadence
+static void check_tones(std::vector<IntentTone> &tones, std::vector<Segment> &segments, double duration,
+                        double tolerance, FileResult &result)
+{
+    const double guard = WINDOW_MS;
+
+    for(IntentTone &tone : tones){
+        if(tone.end > duration - guard)
+            continue;   // cut off by the end of the render
+
+        float nominal_a, nominal_c;
+        if(!nominal_frequencies(tone.label, nominal_a, nominal_c) ||
+           fabsf(tone.freq_a - nominal_a) > 1.0f || fabsf(tone.freq_c - nominal_c) > 1.0f){
+            result.off_tune++;
+            continue;
+        }
+
+        bool masked = false;
+        for(const IntentTone &other : tones){
+            if(other.start > tone.end + guard)
+                break;
+            if(&other != &tone && other.audible && other.end > tone.start - guard){
+                masked = true;
+                break;
+            }
+        }
+        if(masked){
+            result.masked++;
+            continue;
+        }
+
+        tone.checked = true;
+        result.checked++;
+
+        double best_overlap = 0.0;
+        for(size_t i = 0; i < segments.size(); i++){
+            const Segment &segment = segments[i];
+            if(segment.label != tone.label)
+                continue;
+            double overlap = std::min(segment.end, tone.end) - std::max(segment.start, tone.start);
+            if(overlap > best_overlap){
+                best_overlap = overlap;
+                tone.match = (int)i;
+            }
+        }
+        if(tone.match < 0){
+            result.missed++;
+            result.message("missed: station %d '%c' %.0f-%.0f ms", tone.station, tone.label, tone.start, tone.end);
+            continue;
+        }
+
+        Segment &segment = segments[tone.match];
+        segment.matched = true;
+        double start_error = segment.start - tone.start;
+        double end_error = segment.end - tone.end;
+        if(fabs(start_error) > tolerance || fabs(end_error) > tolerance){
+            result.timing++;
+            result.message("timing: station %d '%c' %.0f-%.0f ms heard %.1f-%.1f ms",
+                           tone.station, tone.label, tone.start, tone.end, segment.start, segment.end);
+            tone.match = -1;
+        }
+    }
+
+    // Anything heard where no station was audible
+    for(const Segment &segment : segments){
+        if(segment.matched)
+            continue;
+        bool explained = false;
+        for(const IntentTone &tone : tones){
+            if(tone.start > segment.end + guard)
+                break;
+            if(tone.audible && tone.end > segment.start - guard){
+                explained = true;
+                break;
+            }
+        }
+        if(!explained){
+            result.unexpected++;
+            result.message("unexpected: '%c' heard %.1f-%.1f ms", segment.label, segment.start, segment.end);
+        }
+    }
+
+    // Cadence: on times, and off times between consecutive tones of a station
+    std::vector<const IntentTone *> previous(1, nullptr);
+    for(const IntentTone &tone : tones){
+        if(tone.station >= (int)previous.size())
+            previous.resize(tone.station + 1, nullptr);
+        Cadence &cadence = result.cadence[tone.tone_class];
+        const IntentTone *last = previous[tone.station];
+        previous[tone.station] = &tone;
+        if(!tone.checked)
+            continue;
+
+        cadence.on_intended.add(tone.end - tone.start);
+        if(tone.match >= 0)
+            cadence.on_measured.add(segments[tone.match].end - segments[tone.match].start);
+
+        if(last && last->checked && last->tone_class == tone.tone_class){
+            cadence.off_intended.add(tone.start - last->end);
+            if(tone.match >= 0 && last->match >= 0)
+                cadence.off_measured.add(segments[tone.match].start - segments[last->match].end);
+        }
+    }
+}
+
+// Splits each DTMF station's tones into dialled numbers and compares them with the
+// number the station generated
+static void check_numbers(const std::vector<IntentTone> &tones, const std::vector<IntentNumber> &numbers, FileResult &result)
+{
+    for(const IntentNumber &number : numbers){
+        // Tones of this station from this number until the next one
+        long until = -1;
+        for(const IntentNumber &next : numbers){
+            if(next.station == number.station && next.time > number.time && (until < 0 || next.time < until))
+                until = next.time;
+        }
+
+        std::vector<const IntentTone *> cycle;
+        auto finish = [&]() {
+            if(cycle.empty())
+                return;
+            std::string intended, heard;
+            bool all_heard = true;
+            for(const IntentTone *tone : cycle){
+                intended += tone->label;
+                all_heard = all_heard && tone->checked && tone->match >= 0;
+            }
+            if(number.digits.compare(0, intended.size(), intended)){
+                result.sequence_errors++;
+                result.message("sequence: station %d sent %s for %s", number.station, intended.c_str(), number.digits.c_str());
+            } else if(all_heard && intended.size() == number.digits.size()){
+                result.numbers_heard++;
+            } else {
+                result.numbers_partial++;
+            }
+            cycle.clear();
+        };
+
+        for(const IntentTone &tone : tones){
+            if(tone.station != number.station || tone.tone_class != CLASS_DTMF || !tone.audible ||
+               tone.start < number.time)
+                continue;
+            if(until >= 0 && tone.start >= until)
+                break;
+            if(!cycle.empty() && tone.start - cycle.back()->end > CYCLE_GAP_MS)
+                finish();
+            cycle.push_back(&tone);
+        }
+        finish();
+    }
+}
+
+static void check_file(const std::string &path, double tolerance, FileResult &result)
+{
+    result.path = path;
+
+    std::vector<float> samples;
+    unsigned long sample_rate = 0;
+    if(!read_wav(path.c_str(), samples, sample_rate)){
+        result.error = "cannot read 16-bit mono WAV";
+        return;
+    }
+    std::vector<IntentTone> tones;
+    std::vector<IntentNumber> numbers;
+    std::string intent_path = intent_path_for(path);
+    if(!read_intent(intent_path.c_str(), tones, numbers)){
+        result.error = "cannot read " + intent_path;
+        return;
+    }
+
+    std::vector<Segment> segments = detect(samples, sample_rate);
+    check_tones(tones, segments, 1000.0 * samples.size() / sample_rate, tolerance, result);
+    check_numbers(tones, numbers, result);
+}
+
+static void print_range(const Range &range)
+{
+    if(range.count)
+        printf(" %6.0f %6.0f", range.min, range.max);
+    else
+        printf(" %6s %6s", "-", "-");
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+    double tolerance = DEFAULT_TOLERANCE_MS;
+    bool verbose = false;
+    std::vector<std::string> paths;
+
+    for(int i = 1; i < argc; i++){
+        if(!strcmp(argv[i], "-j") && i + 1 < argc)
+            threads = std::max(1, atoi(argv[++i]));
+        else if(!strcmp(argv[i], "-t") && i + 1 < argc)
+            tolerance = atof(argv[++i]);
+        else if(!strcmp(argv[i], "-v"))
+            verbose = true;
+        else
+            paths.push_back(argv[i]);
+    }
+    if(paths.empty()){
+        fprintf(stderr, "usage: %s [-j threads] [-t tolerance_ms] [-v] render.wav...\n", argv[0]);
+        return 1;
+    }
+
+    auto started = std::chrono::steady_clock::now();
+
+    std::vector<FileResult> results(paths.size());
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    threads = std::min<unsigned int>(threads, paths.size());
+    for(unsigned int t = 0; t < threads; t++){
+        workers.emplace_back([&]() {
+            for(size_t i = next++; i < paths.size(); i = next++)
+                check_file(paths[i], tolerance, results[i]);
+        });
+    }
+    for(std::thread &worker : workers)
+        worker.join();
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    FileResult total;
+    long failed_files = 0;
+    for(const FileResult &result : results){
+        if(result.failed())
+            failed_files++;
+        if(verbose || result.failed()){
+            if(!result.error.empty()){
+                printf("%s: %s\n", result.path.c_str(), result.error.c_str());
+            } else {
+                printf("%s: %ld checked, %ld masked, %ld off tune, %ld missed, %ld timing, %ld unexpected, "
+                       "%ld numbers heard, %ld sequence errors\n",
+                       result.path.c_str(), result.checked, result.masked, result.off_tune, result.missed,
+                       result.timing, result.unexpected, result.numbers_heard, result.sequence_errors);
+            }
+            for(const std::string &message : result.messages)
+                printf("  %s\n", message.c_str());
+        }
+
+        total.checked += result.checked;
+        total.masked += result.masked;
+        total.off_tune += result.off_tune;
+        total.missed += result.missed;
+        total.timing += result.timing;
+        total.unexpected += result.unexpected;
+        total.numbers_heard += result.numbers_heard;
+        total.numbers_partial += result.numbers_partial;
+        total.sequence_errors += result.sequence_errors;
+        for(int c = 0; c < CLASS_COUNT; c++){
+            total.cadence[c].on_intended.merge(result.cadence[c].on_intended);
+            total.cadence[c].on_measured.merge(result.cadence[c].on_measured);
+            total.cadence[c].off_intended.merge(result.cadence[c].off_intended);
+            total.cadence[c].off_measured.merge(result.cadence[c].off_measured);
+        }
+    }
+
+    printf("\nCadence (ms)      count   on: config      intended      measured   off: config      intended      measured\n");
+    for(int c = 0; c < CLASS_COUNT; c++){
+        const Cadence &cadence = total.cadence[c];
+        if(!cadence.on_intended.count)
+            continue;
+        printf("%-16s %6ld   ", class_names[c], cadence.on_intended.count);
+        printf(" %5ld %5ld", class_limits[c][0], class_limits[c][1]);
+        print_range(cadence.on_intended);
+        print_range(cadence.on_measured);
+        printf("       ");
+        if(class_limits[c][2] >= 0)
+            printf(" %5ld %5ld", class_limits[c][2], class_limits[c][3]);
+        else
+            printf(" %5s %5s", "-", "-");
+        print_range(cadence.off_intended);
+        print_range(cadence.off_measured);
+        printf("\n");
+    }
+
+    printf("\n%zu files (%ld failed), %ld tones checked, %ld masked, %ld off tune\n",
+           paths.size(), failed_files, total.checked, total.masked, total.off_tune);
+    printf("%ld missed, %ld timing errors over %.0f ms, %ld unexpected, %ld numbers heard in full, "
+           "%ld partly heard, %ld sequence errors\n",
+           total.missed, total.timing, tolerance, total.unexpected, total.numbers_heard, total.numbers_partial,
+           total.sequence_errors);
+    printf("checked in %.2f s on %u threads (%.0f files per minute)\n", elapsed, threads, paths.size() * 60.0 / elapsed);
+    return failed_files ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+# PlatformIO custom target: RAM and Flash use per translation unit
+#
+#   pio run -e nano_every -t ram_report
+#
+# For each object in the firmware build: .data, .bss and .rodata in RAM, code in Flash,
+# and the largest stack frame from the -fstack-usage files GCC writes next to it.
+# Static sizes are before --gc-sections, so a unit's share of the final image can be
+# smaller. The totals at the end come from the linked ELF. .rodata is copied into RAM
+# on the ATmega328; on the ATmega4809 it stays in memory-mapped Flash.
+#
+# Enabled with extra_scripts in platformio.ini.
+
+Import("env")
+
+import os
+import subprocess
+
+
+def section_sizes(size_tool, path, env):
+    # "avr-size -A" lists every section with its size
+    sizes = {"text": 0, "data": 0, "bss": 0, "rodata": 0}
+    output = subprocess.check_output([size_tool, "-A", path], env=env["ENV"], universal_newlines=True)
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) < 2 or not fields[0].startswith(".") or not fields[1].isdigit():
+            continue
+        name, size = fields[0], int(fields[1])
+        if name.startswith(".text") or name.startswith(".progmem"):
+            sizes["text"] += size
+        elif name.startswith(".rodata"):
+            sizes["rodata"] += size
+        elif name.startswith(".data"):
+            sizes["data"] += size
+        elif name.startswith(".bss") or name.startswith(".noinit"):
+            sizes["bss"] += size
+    return sizes
+
+
+def largest_frame(path):
+    # lines of "file:line:column:function<TAB>bytes<TAB>static|dynamic"
+    su = os.path.splitext(path)[0] + ".su"
+    best = (0, "")
+    if os.path.isfile(su):
+        with open(su) as f:
+            for line in f:
+                fields = line.rstrip("\n").split("\t")
+                if len(fields) >= 2 and fields[1].isdigit() and int(fields[1]) > best[0]:
+                    best = (int(fields[1]), fields[0].split(":", 3)[-1])
+    return best
+
+
+def ram_report(target, source, env):
+    build_dir = env.subst("$BUILD_DIR")
+    size_tool = env.subst("$SIZETOOL")
+    rows = []
+    for root, dirs, files in os.walk(build_dir):
+        for name in files:
+            if name.endswith(".o"):
+                path = os.path.join(root, name)
+                rows.append((os.path.relpath(path, build_dir), section_sizes(size_tool, path, env), largest_frame(path)))
+    rows.sort(key=lambda row: row[1]["data"] + row[1]["bss"], reverse=True)
+
+    print("%-44s %6s %6s %6s %7s %6s  %s" % ("object", "data", "bss", "rodata", "text", "frame", "largest frame"))
+    for path, sizes, frame in rows:
+        print("%-44s %6d %6d %6d %7d %6s  %s" % (path, sizes["data"], sizes["bss"], sizes["rodata"], sizes["text"],
+                                                frame[0] or "", frame[1]))
+
+    elf = env.subst("$BUILD_DIR/${PROGNAME}.elf")
+    sizes = section_sizes(size_tool, elf, env)
+    ram = int(env.BoardConfig().get("upload.maximum_ram_size", 0))
+    used = sizes["data"] + sizes["bss"]
+    print("\nlinked: .data %d, .bss %d, %d of %d bytes of RAM, %d left for the stack"
+          % (sizes["data"], sizes["bss"], used, ram, ram - used))
+
+
+env.AddCustomTarget(
+    name="ram_report",
+    dependencies="$BUILD_DIR/${PROGNAME}.elf",
+    actions=ram_report,
+    title="RAM Report",
+    description="RAM, Flash and largest stack frame per translation unit")
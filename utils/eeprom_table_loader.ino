@@ -18,7 +18,8 @@
 // - Morse table: 36 bytes at address 100-135
 // - Baudot table: 128 bytes at address 140-267
 // - Magic numbers: 2 bytes at addresses 99, 139
-// - Total EEPROM used: 166 bytes (addresses 99-267)
+// - CRC-8 per table: 2 bytes at addresses 136, 268
+// - Total EEPROM used: 168 bytes (addresses 99-268)
 
 #include <Arduino.h>
 #include <EEPROM.h>
@@ -78,10 +79,12 @@ void setup() {
     Serial.println("  Addresses 0-99:   FluxTune settings (preserved)");
     Serial.println("  Address 99:       Morse table magic number");
     Serial.println("  Addresses 100-135: Morse lookup table (36 bytes)");
+    Serial.println("  Address 136:      Morse table CRC-8");
     Serial.println("  Address 139:      Baudot table magic number");
     Serial.println("  Addresses 140-267: Baudot lookup table (128 bytes)");
+    Serial.println("  Address 268:      Baudot table CRC-8");
     Serial.println();
-    Serial.println("Total EEPROM used: 166 bytes");
+    Serial.println("Total EEPROM used: 168 bytes");
     Serial.println("Flash memory saved: ~164 bytes");
     Serial.println();
     Serial.println("Loader complete. You may now upload your main sketch.");
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+# Generates the SignalMeter strength lookup tables in src/signal_meter.cpp
+#
+# Each entry maps _current_strength (0-255) to a packed byte:
+#   high nibble = number of lit LEDs (1-7), low nibble = partial brightness of the last LED (0-15)
+# using the same arithmetic the meter previously did at run time (float sqrt scaling included).
+#
+# Usage: python3 utils/signal_meter_table.py
+
+import struct
+
+LED_COUNT = 7
+
+def f32(x):
+    return struct.unpack('f', struct.pack('f', x))[0]
+
+def sqrt_strength(strength):
+    if strength <= 0:
+        return 0
+    # sqrtf() is correctly rounded to float, then scaled by 16.0f (exact)
+    display = int(f32(f32(strength) ** 0.5) * 16.0)
+    return min(display, 255)
+
+def pack(display_strength):
+    sample = display_strength * 2
+    on_leds = min(sample // 73 + 1, LED_COUNT)
+    remain = ((sample % 73) * 16) // 73
+    return (on_leds << 4) | remain
+
+def emit(name, fn):
+    values = [pack(fn(s)) for s in range(256)]
+    print("const uint8_t %s[256] PROGMEM = {" % name)
+    for row in range(0, 256, 16):
+        print("    " + ", ".join("0x%02X" % v for v in values[row:row + 16]) + ",")
+    print("};")
+
+print("#ifdef ENABLE_LOGARITHMIC_S_METER")
+emit("STRENGTH_TO_LEDS", sqrt_strength)
+print("#else")
+emit("STRENGTH_TO_LEDS", lambda s: s)
+print("#endif")